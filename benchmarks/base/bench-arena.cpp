@@ -0,0 +1,106 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/arena.hpp>
+#include <kouta/base/component.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::benchmarks::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// Number of subtrees created and destroyed in each iteration.
+        constexpr std::size_t BurstSize{1000};
+
+        /// @brief Component with some state, similar to those in a per-connection subtree.
+        class Session : public Component
+        {
+        public:
+            explicit Session(Component* parent)
+                : Component{parent}
+                , m_state{}
+            {
+            }
+
+        private:
+            std::byte m_state[128];
+        };
+    }  // namespace
+
+    void BM_SubtreeChurnHeap(benchmark::State& state)
+    {
+        auto children{static_cast<std::size_t>(state.range(0))};
+        Root root{};
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < BurstSize; i++)
+            {
+                auto* subtree{new Component{&root}};
+
+                for (std::size_t j = 0; j < children; j++)
+                {
+                    new Session{subtree};
+                }
+
+                delete subtree;
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BurstSize));
+    }
+
+    void BM_SubtreeChurnPool(benchmark::State& state)
+    {
+        auto children{static_cast<std::size_t>(state.range(0))};
+        Root root{};
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < BurstSize; i++)
+            {
+                auto* subtree{make_child<Component>(&root)};
+
+                for (std::size_t j = 0; j < children; j++)
+                {
+                    make_child<Session>(subtree);
+                }
+
+                delete subtree;
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BurstSize));
+    }
+
+    void BM_SubtreeChurnArena(benchmark::State& state)
+    {
+        auto children{static_cast<std::size_t>(state.range(0))};
+        Root root{};
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < BurstSize; i++)
+            {
+                auto* subtree{make_child<Arena>(&root)};
+
+                for (std::size_t j = 0; j < children; j++)
+                {
+                    make_child<Session>(subtree);
+                }
+
+                delete subtree;
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BurstSize));
+    }
+
+    BENCHMARK(BM_SubtreeChurnHeap)->Arg(4)->Arg(16);
+    BENCHMARK(BM_SubtreeChurnPool)->Arg(4)->Arg(16);
+    BENCHMARK(BM_SubtreeChurnArena)->Arg(4)->Arg(16);
+}  // namespace kouta::benchmarks::base
@@ -0,0 +1,134 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/branch.hpp>
+#include <kouta/base/callback.hpp>
+#include <kouta/base/channel.hpp>
+
+namespace kouta::benchmarks::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// Number of items sent in each iteration of the throughput benchmarks.
+        constexpr std::uint64_t BurstSize{1000};
+
+        /// @brief Component that counts the items it receives, either through a channel or posted calls.
+        class Consumer : public Component
+        {
+        public:
+            explicit Consumer(Component* parent)
+                : Component{parent}
+                , channel{this, callback::DirectCallback{this, &Consumer::handle_item}, 4096}
+                , received{0}
+            {
+            }
+
+            void handle_item(const std::uint64_t&)
+            {
+                received.fetch_add(1, std::memory_order_release);
+            }
+
+            void handle_posted(std::uint64_t)
+            {
+                received.fetch_add(1, std::memory_order_release);
+            }
+
+            /// @brief Wait until the given number of items has been received.
+            void wait_for(std::uint64_t count) const
+            {
+                while (received.load(std::memory_order_acquire) < count)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            Channel<std::uint64_t> channel;
+            std::atomic<std::uint64_t> received;
+        };
+    }  // namespace
+
+    void BM_ChannelThroughput(benchmark::State& state)
+    {
+        Branch<Consumer> branch{nullptr};
+        auto& consumer{branch.component()};
+        std::uint64_t sent{0};
+
+        branch.run();
+
+        for (auto _ : state)
+        {
+            for (std::uint64_t i = 0; i < BurstSize; i++, sent++)
+            {
+                while (!consumer.channel.try_send(i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            consumer.wait_for(sent);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(sent));
+    }
+
+    void BM_PostThroughput(benchmark::State& state)
+    {
+        Branch<Consumer> branch{nullptr};
+        auto& consumer{branch.component()};
+        std::uint64_t sent{0};
+
+        branch.run();
+
+        for (auto _ : state)
+        {
+            for (std::uint64_t i = 0; i < BurstSize; i++, sent++)
+            {
+                branch.post(&Consumer::handle_posted, i);
+            }
+
+            consumer.wait_for(sent);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(sent));
+    }
+
+    void BM_ChannelLatency(benchmark::State& state)
+    {
+        Branch<Consumer> branch{nullptr};
+        auto& consumer{branch.component()};
+        std::uint64_t sent{0};
+
+        branch.run();
+
+        for (auto _ : state)
+        {
+            consumer.channel.try_send(sent++);
+            consumer.wait_for(sent);
+        }
+    }
+
+    void BM_PostLatency(benchmark::State& state)
+    {
+        Branch<Consumer> branch{nullptr};
+        auto& consumer{branch.component()};
+        std::uint64_t sent{0};
+
+        branch.run();
+
+        for (auto _ : state)
+        {
+            branch.post(&Consumer::handle_posted, sent++);
+            consumer.wait_for(sent);
+        }
+    }
+
+    BENCHMARK(BM_ChannelThroughput)->UseRealTime();
+    BENCHMARK(BM_PostThroughput)->UseRealTime();
+    BENCHMARK(BM_ChannelLatency)->UseRealTime();
+    BENCHMARK(BM_PostLatency)->UseRealTime();
+}  // namespace kouta::benchmarks::base
@@ -0,0 +1,100 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/branch.hpp>
+#include <kouta/base/component-handle.hpp>
+
+namespace kouta::benchmarks::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// Number of events posted in each iteration.
+        constexpr std::uint64_t BurstSize{1000};
+
+        /// @brief Component that counts the events it receives.
+        class Target : public Component
+        {
+        public:
+            explicit Target(Component* parent, std::atomic<std::uint64_t>* received)
+                : Component{parent}
+                , m_received{received}
+            {
+            }
+
+            void handle_value(std::uint64_t)
+            {
+                m_received->fetch_add(1, std::memory_order_release);
+            }
+
+        private:
+            std::atomic<std::uint64_t>* m_received;
+        };
+
+        /// @brief Wait until the given number of events has been received.
+        void wait_for(const std::atomic<std::uint64_t>& received, std::uint64_t count)
+        {
+            while (received.load(std::memory_order_acquire) < count)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }  // namespace
+
+    void BM_PostComponentHandle(benchmark::State& state)
+    {
+        std::atomic<std::uint64_t> received{0};
+        Branch<Component> branch{nullptr};
+        ComponentHandle handle{new Target{&branch.component(), &received}};
+        std::uint64_t sent{0};
+
+        branch.run();
+
+        for (auto _ : state)
+        {
+            for (std::uint64_t i = 0; i < BurstSize; i++, sent++)
+            {
+                handle.post(&Target::handle_value, i);
+            }
+
+            wait_for(received, sent);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(sent));
+    }
+
+    void BM_PostSharedPtr(benchmark::State& state)
+    {
+        std::atomic<std::uint64_t> received{0};
+        Branch<Component> branch{nullptr};
+        auto target{std::make_shared<Target>(nullptr, &received)};
+        std::uint64_t sent{0};
+
+        branch.run();
+
+        for (auto _ : state)
+        {
+            for (std::uint64_t i = 0; i < BurstSize; i++, sent++)
+            {
+                // Keep the target alive until the event is handled
+                asio::post(branch.context().get_executor(),
+                           [target, i]()
+                           {
+                               target->handle_value(i);
+                           });
+            }
+
+            wait_for(received, sent);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(sent));
+    }
+
+    BENCHMARK(BM_PostComponentHandle)->UseRealTime();
+    BENCHMARK(BM_PostSharedPtr)->UseRealTime();
+}  // namespace kouta::benchmarks::base
@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/component.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::benchmarks::base
+{
+    using namespace kouta::base;
+
+    void BM_ComponentTreeTeardown(benchmark::State& state)
+    {
+        auto count{static_cast<std::size_t>(state.range(0))};
+
+        for (auto _ : state)
+        {
+            Root root{};
+            auto* parent{new Component{&root}};
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                new Component{parent};
+            }
+
+            // Children are deleted in reverse order
+            delete parent;
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void BM_ComponentCreationOrderRemoval(benchmark::State& state)
+    {
+        auto count{static_cast<std::size_t>(state.range(0))};
+        std::vector<Component*> children(count);
+
+        for (auto _ : state)
+        {
+            Root root{};
+
+            for (auto& child : children)
+            {
+                child = new Component{&root};
+            }
+
+            // Worst case for a vector, as each child is removed from the front of the list
+            for (auto* child : children)
+            {
+                delete child;
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    BENCHMARK(BM_ComponentTreeTeardown)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+    BENCHMARK(BM_ComponentCreationOrderRemoval)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+}  // namespace kouta::benchmarks::base
@@ -0,0 +1,84 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/branch.hpp>
+#include <kouta/base/lanes.hpp>
+
+namespace kouta::benchmarks::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// Number of events posted in each iteration.
+        constexpr std::uint64_t BurstSize{1000};
+
+        /// @brief Component that counts the events it receives.
+        class Target : public Component
+        {
+        public:
+            explicit Target(Component* parent)
+                : Component{parent}
+                , received{0}
+            {
+            }
+
+            void handle_value(std::uint64_t)
+            {
+                received.fetch_add(1, std::memory_order_release);
+            }
+
+            std::atomic<std::uint64_t> received;
+        };
+
+        /// @brief Post bursts of events with the given posting function and wait for them to be handled.
+        template<class TPost>
+        void post_bursts(benchmark::State& state, TPost&& post)
+        {
+            Branch<Target> branch{nullptr};
+            auto& target{branch.component()};
+            std::uint64_t sent{0};
+
+            branch.run();
+
+            for (auto _ : state)
+            {
+                for (std::uint64_t i = 0; i < BurstSize; i++, sent++)
+                {
+                    post(target, i);
+                }
+
+                while (target.received.load(std::memory_order_acquire) < sent)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            state.SetItemsProcessed(static_cast<std::int64_t>(sent));
+        }
+    }  // namespace
+
+    void BM_PostUnprioritized(benchmark::State& state)
+    {
+        post_bursts(state,
+                    [](Target& target, std::uint64_t value)
+                    {
+                        target.post(&Target::handle_value, value);
+                    });
+    }
+
+    void BM_PostLane(benchmark::State& state)
+    {
+        post_bursts(state,
+                    [](Target& target, std::uint64_t value)
+                    {
+                        target.post<Priority::Bulk>(&Target::handle_value, value);
+                    });
+    }
+
+    BENCHMARK(BM_PostUnprioritized)->UseRealTime();
+    BENCHMARK(BM_PostLane)->UseRealTime();
+}  // namespace kouta::benchmarks::base
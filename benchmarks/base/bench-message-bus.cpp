@@ -0,0 +1,150 @@
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/branch.hpp>
+#include <kouta/base/callback.hpp>
+#include <kouta/base/message-bus.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::benchmarks::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// Number of branches the subscribers are distributed across.
+        constexpr std::size_t BranchCount{4};
+
+        /// Number of messages published in each iteration.
+        constexpr std::uint64_t BurstSize{100};
+
+        struct Sample
+        {
+            std::uint64_t value;
+        };
+
+        /// @brief Component that counts the messages it receives.
+        class Subscriber : public Component
+        {
+        public:
+            Subscriber(Component* parent, std::atomic<std::uint64_t>* received)
+                : Component{parent}
+                , m_received{received}
+            {
+            }
+
+            void handle_sample(const Sample&)
+            {
+                m_received->fetch_add(1, std::memory_order_release);
+            }
+
+        private:
+            std::atomic<std::uint64_t>* m_received;
+        };
+
+        /// @brief Set of branches with subscribers evenly distributed across them.
+        class FanOut
+        {
+        public:
+            explicit FanOut(std::size_t subscribers)
+                : received{0}
+                , root{}
+                , branches{}
+                , subscribers{}
+            {
+                for (auto& branch : branches)
+                {
+                    branch = std::make_unique<Branch<Component>>(nullptr);
+                }
+
+                for (std::size_t i = 0; i < subscribers; i++)
+                {
+                    // Owned by the wrapped component of the branch
+                    this->subscribers.push_back(
+                        new Subscriber{&branches[i % BranchCount]->component(), &received});
+                }
+
+                for (auto& branch : branches)
+                {
+                    branch->run();
+                }
+            }
+
+            /// @brief Wait until the given number of messages has been received.
+            void wait_for(std::uint64_t count) const
+            {
+                while (received.load(std::memory_order_acquire) < count)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            std::atomic<std::uint64_t> received;
+            Root root;
+            std::array<std::unique_ptr<Branch<Component>>, BranchCount> branches;
+            std::vector<Subscriber*> subscribers;
+        };
+    }  // namespace
+
+    void BM_MessageBusFanOut(benchmark::State& state)
+    {
+        FanOut fan_out{static_cast<std::size_t>(state.range(0))};
+        MessageBus<Sample> bus{&fan_out.root};
+        std::uint64_t expected{0};
+
+        for (auto* subscriber : fan_out.subscribers)
+        {
+            bus.subscribe(subscriber, &Subscriber::handle_sample);
+        }
+
+        for (auto _ : state)
+        {
+            for (std::uint64_t i = 0; i < BurstSize; i++)
+            {
+                bus.publish(Sample{i});
+            }
+
+            expected += BurstSize * fan_out.subscribers.size();
+            fan_out.wait_for(expected);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(expected));
+    }
+
+    void BM_DeferredCallbackFanOut(benchmark::State& state)
+    {
+        FanOut fan_out{static_cast<std::size_t>(state.range(0))};
+        std::vector<Callback<const Sample&>> callbacks{};
+        std::uint64_t expected{0};
+
+        for (auto* subscriber : fan_out.subscribers)
+        {
+            callbacks.push_back(callback::DeferredCallback{subscriber, &Subscriber::handle_sample});
+        }
+
+        for (auto _ : state)
+        {
+            for (std::uint64_t i = 0; i < BurstSize; i++)
+            {
+                for (const auto& callback : callbacks)
+                {
+                    callback(Sample{i});
+                }
+            }
+
+            expected += BurstSize * fan_out.subscribers.size();
+            fan_out.wait_for(expected);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(expected));
+    }
+
+    BENCHMARK(BM_MessageBusFanOut)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+    BENCHMARK(BM_DeferredCallbackFanOut)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+}  // namespace kouta::benchmarks::base
@@ -0,0 +1,141 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/root.hpp>
+
+namespace kouta::benchmarks::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// Number of components the events are distributed across.
+        constexpr std::size_t ComponentCount{8};
+
+        /// Number of events posted in each iteration.
+        constexpr std::uint64_t BurstSize{4000};
+
+        /// Amount of work performed by each event.
+        constexpr std::uint64_t WorkSize{500};
+
+        /// @brief Component that performs some work for each event it receives.
+        class Worker : public Component
+        {
+        public:
+            Worker(Component* parent, bool serialized, std::atomic<std::uint64_t>* received)
+                : Component{parent}
+                , m_received{received}
+                , m_state{0}
+            {
+                if (serialized)
+                {
+                    enable_strand();
+                }
+            }
+
+            void handle_value(std::uint64_t value)
+            {
+                for (std::uint64_t i = 0; i < WorkSize; i++)
+                {
+                    value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+                }
+
+                benchmark::DoNotOptimize(m_state += value);
+                m_received->fetch_add(1, std::memory_order_release);
+            }
+
+        private:
+            std::atomic<std::uint64_t>* m_received;
+            std::uint64_t m_state;
+        };
+
+        /// @brief Root whose event loop is run from several threads.
+        class Pool
+        {
+        public:
+            Pool(std::size_t threads, bool serialized)
+                : received{0}
+                , root{}
+                , workers{}
+                , m_threads{}
+            {
+                for (std::size_t i = 0; i < ComponentCount; i++)
+                {
+                    workers.push_back(std::make_unique<Worker>(&root, serialized, &received));
+                }
+
+                for (std::size_t i = 0; i < threads; i++)
+                {
+                    m_threads.emplace_back(
+                        [this]()
+                        {
+                            root.run();
+                        });
+                }
+            }
+
+            ~Pool()
+            {
+                root.stop();
+
+                for (auto& thread : m_threads)
+                {
+                    thread.join();
+                }
+            }
+
+            /// @brief Wait until the given number of events has been received.
+            void wait_for(std::uint64_t count) const
+            {
+                while (received.load(std::memory_order_acquire) < count)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            std::atomic<std::uint64_t> received;
+            Root root;
+            std::vector<std::unique_ptr<Worker>> workers;
+
+        private:
+            std::vector<std::thread> m_threads;
+        };
+
+        /// @brief Post bursts of events, evenly distributed across the components, to a multi-threaded loop.
+        void post_bursts(benchmark::State& state, bool serialized)
+        {
+            Pool pool{static_cast<std::size_t>(state.range(0)), serialized};
+            std::uint64_t sent{0};
+
+            for (auto _ : state)
+            {
+                for (std::uint64_t i = 0; i < BurstSize; i++, sent++)
+                {
+                    pool.workers[i % ComponentCount]->post(&Worker::handle_value, i);
+                }
+
+                pool.wait_for(sent);
+            }
+
+            state.SetItemsProcessed(static_cast<std::int64_t>(sent));
+        }
+    }  // namespace
+
+    void BM_PostParallel(benchmark::State& state)
+    {
+        post_bursts(state, false);
+    }
+
+    void BM_PostStrand(benchmark::State& state)
+    {
+        post_bursts(state, true);
+    }
+
+    BENCHMARK(BM_PostParallel)->RangeMultiplier(2)->Range(1, 4)->UseRealTime();
+    BENCHMARK(BM_PostStrand)->RangeMultiplier(2)->Range(1, 4)->UseRealTime();
+}  // namespace kouta::benchmarks::base
@@ -0,0 +1,51 @@
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/io/buffer-pool.hpp>
+
+namespace kouta::benchmarks::io
+{
+    using namespace kouta::io;
+
+    void BM_BufferPoolAllocate(benchmark::State& state)
+    {
+        BufferPool pool{static_cast<std::size_t>(state.range(0))};
+
+        for (auto _ : state)
+        {
+            auto slice{pool.allocate()};
+            slice.data()[0] = 0x42;
+            benchmark::DoNotOptimize(slice.data().data());
+        }
+    }
+
+    void BM_BufferPoolShare(benchmark::State& state)
+    {
+        BufferPool pool{static_cast<std::size_t>(state.range(0))};
+        auto slice{pool.allocate()};
+
+        for (auto _ : state)
+        {
+            // Equivalent to handing the payload over to a deferred callback
+            auto copy{slice};
+            benchmark::DoNotOptimize(copy.data().data());
+        }
+    }
+
+    void BM_VectorCopy(benchmark::State& state)
+    {
+        std::vector<std::uint8_t> payload(static_cast<std::size_t>(state.range(0)), 0x42);
+
+        for (auto _ : state)
+        {
+            auto copy{payload};
+            benchmark::DoNotOptimize(copy.data());
+        }
+    }
+
+    BENCHMARK(BM_BufferPoolAllocate)->RangeMultiplier(8)->Range(64, 1 << 15);
+    BENCHMARK(BM_BufferPoolShare)->RangeMultiplier(8)->Range(64, 1 << 15);
+    BENCHMARK(BM_VectorCopy)->RangeMultiplier(8)->Range(64, 1 << 15);
+}  // namespace kouta::benchmarks::io
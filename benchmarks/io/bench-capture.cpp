@@ -0,0 +1,131 @@
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/io/capture.hpp>
+
+namespace kouta::benchmarks::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// @brief Obtain a unique path for a temporary file.
+        std::filesystem::path temp_path(const std::string& name)
+        {
+            return std::filesystem::temp_directory_path() / ("kouta-bench-" + name + "-" + std::to_string(::getpid()));
+        }
+
+        /// @brief Write a capture of `count` blocks of 256 bytes.
+        void write_capture(const std::filesystem::path& path, std::int64_t count)
+        {
+            capture::Writer writer{path};
+            std::vector<std::uint8_t> payload(256, 0x5A);
+
+            for (std::int64_t i = 0; i < count; i++)
+            {
+                writer.append(static_cast<std::uint64_t>(i), payload);
+            }
+        }
+    }  // namespace
+
+    /// @brief Append blocks of 256 bytes to a capture.
+    void BM_CaptureWrite(benchmark::State& state)
+    {
+        auto path{temp_path("capture-write")};
+
+        for (auto _ : state)
+        {
+            write_capture(path, state.range(0));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Seek to a random timestamp through the index.
+    void BM_CaptureSeek(benchmark::State& state)
+    {
+        auto path{temp_path("capture-seek")};
+
+        write_capture(path, state.range(0));
+
+        capture::Reader reader{path};
+        std::uint64_t timestamp{0};
+
+        for (auto _ : state)
+        {
+            timestamp = (timestamp + 7919) % static_cast<std::uint64_t>(state.range(0));
+            benchmark::DoNotOptimize(reader.seek(timestamp));
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Seek to a random timestamp by scanning the blocks from the start.
+    void BM_CaptureSeekScan(benchmark::State& state)
+    {
+        auto path{temp_path("capture-scan")};
+
+        write_capture(path, state.range(0));
+
+        capture::Reader reader{path};
+        std::uint64_t timestamp{0};
+
+        for (auto _ : state)
+        {
+            timestamp = (timestamp + 7919) % static_cast<std::uint64_t>(state.range(0));
+
+            std::size_t offset{reader.range().begin};
+
+            while (auto record{reader.read(offset)})
+            {
+                if (record->timestamp >= timestamp)
+                {
+                    break;
+                }
+            }
+
+            benchmark::DoNotOptimize(offset);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Replay (read and verify) all the blocks of a capture.
+    void BM_CaptureReplay(benchmark::State& state)
+    {
+        auto path{temp_path("capture-replay")};
+
+        write_capture(path, state.range(0));
+
+        capture::Reader reader{path};
+
+        for (auto _ : state)
+        {
+            std::size_t count{0};
+
+            reader.replay(
+                reader.range(),
+                [&count](const capture::Record& record)
+                {
+                    count += record.payload.size();
+                });
+
+            benchmark::DoNotOptimize(count);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        std::filesystem::remove(path);
+    }
+
+    BENCHMARK(BM_CaptureWrite)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+    BENCHMARK(BM_CaptureSeek)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+    BENCHMARK(BM_CaptureSeekScan)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+    BENCHMARK(BM_CaptureReplay)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+}  // namespace kouta::benchmarks::io
@@ -0,0 +1,89 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/io/checksum.hpp>
+
+namespace kouta::benchmarks::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        std::vector<std::uint8_t> make_data(std::size_t count)
+        {
+            std::mt19937 gen{42};
+            std::vector<std::uint8_t> data(count);
+
+            for (auto& b : data)
+            {
+                b = static_cast<std::uint8_t>(gen());
+            }
+
+            return data;
+        }
+
+        /// @brief Benchmark a checksum function over a buffer of `state.range(0)` bytes.
+        template<class TFunction>
+        void run_checksum(benchmark::State& state, TFunction&& function)
+        {
+            auto data{make_data(static_cast<std::size_t>(state.range(0)))};
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(function(std::span<const std::uint8_t>{data}));
+            }
+
+            state.SetBytesProcessed(state.iterations() * state.range(0));
+        }
+    }  // namespace
+
+    void BM_Crc32(benchmark::State& state)
+    {
+        run_checksum(state, checksum::Crc32{});
+    }
+
+    void BM_Crc32Portable(benchmark::State& state)
+    {
+        run_checksum(
+            state,
+            [](std::span<const std::uint8_t> view)
+            {
+                return ~checksum::detail::crc32_portable(~0U, view.data(), view.size());
+            });
+    }
+
+    void BM_Crc32c(benchmark::State& state)
+    {
+        run_checksum(state, checksum::Crc32c{});
+    }
+
+    void BM_Crc32cPortable(benchmark::State& state)
+    {
+        run_checksum(
+            state,
+            [](std::span<const std::uint8_t> view)
+            {
+                return ~checksum::detail::crc32c_portable(~0U, view.data(), view.size());
+            });
+    }
+
+    void BM_Crc16(benchmark::State& state)
+    {
+        run_checksum(state, checksum::Crc16{});
+    }
+
+    void BM_Adler32(benchmark::State& state)
+    {
+        run_checksum(state, checksum::Adler32{});
+    }
+
+    BENCHMARK(BM_Crc32)->RangeMultiplier(16)->Range(64, 1 << 20);
+    BENCHMARK(BM_Crc32Portable)->RangeMultiplier(16)->Range(64, 1 << 20);
+    BENCHMARK(BM_Crc32c)->RangeMultiplier(16)->Range(64, 1 << 20);
+    BENCHMARK(BM_Crc32cPortable)->RangeMultiplier(16)->Range(64, 1 << 20);
+    BENCHMARK(BM_Crc16)->RangeMultiplier(16)->Range(64, 1 << 20);
+    BENCHMARK(BM_Adler32)->RangeMultiplier(16)->Range(64, 1 << 20);
+}  // namespace kouta::benchmarks::io
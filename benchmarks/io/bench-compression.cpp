@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/io/compression.hpp>
+#include <kouta/io/packer.hpp>
+
+namespace kouta::benchmarks::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// @brief Generate a block of at least `size` bytes made of repetitive frames.
+        Packer make_block(std::size_t size)
+        {
+            Packer packer{size};
+
+            for (std::uint32_t i = 0; packer.size() < size; i++)
+            {
+                packer.insert_integral<std::uint16_t>(0xCAFE);
+                packer.insert_integral<std::uint32_t>(i);
+                packer.insert_integral<std::uint64_t>(1700000000000 + i * 1000);
+                packer.insert_string("sensor-reading");
+                packer.insert_floating_point<double>(20.0 + (i % 16) * 0.125);
+            }
+
+            return packer;
+        }
+    }  // namespace
+
+    /// @brief Compress blocks of `state.range(0)` bytes, reporting the compression ratio.
+    void BM_Compress(benchmark::State& state, compression::Codec codec)
+    {
+        auto block{make_block(static_cast<std::size_t>(state.range(0)))};
+        compression::Compressor compressor{codec};
+        std::size_t compressed{0};
+
+        for (auto _ : state)
+        {
+            compressed = compressor.compress(block.data()).size();
+            benchmark::DoNotOptimize(compressed);
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * block.size()));
+        state.counters["ratio"] = static_cast<double>(block.size()) / static_cast<double>(compressed);
+    }
+
+    /// @brief Decompress blocks of `state.range(0)` bytes.
+    void BM_Decompress(benchmark::State& state, compression::Codec codec)
+    {
+        auto block{make_block(static_cast<std::size_t>(state.range(0)))};
+        compression::Compressor compressor{codec};
+        compression::Decompressor decompressor{};
+        std::vector<std::uint8_t> compressed{};
+
+        std::ranges::copy(compressor.compress(block.data()), std::back_inserter(compressed));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(decompressor.decompress(codec, compressed, block.size()));
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * block.size()));
+    }
+
+#ifdef KOUTA_USE_LZ4
+    BENCHMARK_CAPTURE(BM_Compress, lz4, compression::Codec::Lz4)->RangeMultiplier(4)->Range(1 << 12, 1 << 20);
+    BENCHMARK_CAPTURE(BM_Decompress, lz4, compression::Codec::Lz4)->RangeMultiplier(4)->Range(1 << 12, 1 << 20);
+#endif
+
+#ifdef KOUTA_USE_ZSTD
+    BENCHMARK_CAPTURE(BM_Compress, zstd, compression::Codec::Zstd)->RangeMultiplier(4)->Range(1 << 12, 1 << 20);
+    BENCHMARK_CAPTURE(BM_Decompress, zstd, compression::Codec::Zstd)->RangeMultiplier(4)->Range(1 << 12, 1 << 20);
+#endif
+}  // namespace kouta::benchmarks::io
@@ -0,0 +1,104 @@
+#if defined(__linux__)
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/callback.hpp>
+#include <kouta/base/root.hpp>
+#include <kouta/io/datagram-component.hpp>
+
+namespace kouta::benchmarks::io
+{
+    using namespace kouta::io;
+    namespace asio = kouta::base::asio;
+
+    namespace
+    {
+        /// Number of datagrams sent in each iteration.
+        constexpr std::size_t BurstSize{256};
+
+        /// @brief Root that sends bursts of datagrams over the loopback interface.
+        class DatagramRoot : public base::Root
+        {
+        public:
+            explicit DatagramRoot(std::size_t batch_size)
+                : base::Root{}
+                , sender{this,
+                         base::callback::DirectCallback<std::span<const Datagram>>{[](std::span<const Datagram>) {}},
+                         base::callback::DirectCallback{this, &DatagramRoot::handle_error},
+                         batch_size}
+                , receiver{this,
+                           base::callback::DirectCallback{this, &DatagramRoot::handle_received},
+                           base::callback::DirectCallback{this, &DatagramRoot::handle_error},
+                           batch_size}
+                , received{0}
+            {
+                sender.socket().open(asio::ip::udp::v4());
+                receiver.socket().open(asio::ip::udp::v4());
+                receiver.socket().set_option(asio::socket_base::receive_buffer_size{8 << 20});
+                receiver.socket().bind({asio::ip::address_v4::loopback(), 0});
+                receiver.start();
+            }
+
+            /// @brief Send a burst of datagrams and wait for them (or until no more datagrams arrive).
+            void run_burst(std::size_t size)
+            {
+                auto destination{receiver.socket().local_endpoint()};
+                std::size_t target{received + BurstSize};
+
+                for (std::size_t i = 0; i < BurstSize; i++)
+                {
+                    Packer packer{size};
+                    packer.insert_bytes(std::vector<std::uint8_t>(size, 0x42));
+                    sender.send(destination, std::move(packer));
+                }
+
+                while (received < target && context().run_one_for(std::chrono::milliseconds{100}) > 0)
+                {
+                }
+            }
+
+            DatagramComponent sender;
+            DatagramComponent receiver;
+            std::size_t received;
+
+        private:
+            void handle_received(std::span<const Datagram> batch)
+            {
+                received += batch.size();
+            }
+
+            void handle_error(const asio::error_code& ec)
+            {
+                throw asio::system_error{ec};
+            }
+        };
+    }  // namespace
+
+    /// @brief Benchmark the datagram rate over the loopback interface.
+    ///
+    /// @details
+    /// The first argument is the size of the datagrams and the second one the batch size (a batch size of one is
+    /// equivalent to a system call per datagram).
+    void BM_DatagramComponent(benchmark::State& state)
+    {
+        DatagramRoot root{static_cast<std::size_t>(state.range(1))};
+        auto size{static_cast<std::size_t>(state.range(0))};
+
+        for (auto _ : state)
+        {
+            root.run_burst(size);
+        }
+
+        // Only count the datagrams that were actually received
+        state.SetItemsProcessed(static_cast<std::int64_t>(root.received));
+        state.SetBytesProcessed(static_cast<std::int64_t>(root.received * size));
+    }
+
+    BENCHMARK(BM_DatagramComponent)->ArgsProduct({{64, 1024}, {1, 8, 64}});
+}  // namespace kouta::benchmarks::io
+
+#endif
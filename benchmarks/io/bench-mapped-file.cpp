@@ -0,0 +1,123 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/io/checksum.hpp>
+#include <kouta/io/mapped-file.hpp>
+#include <kouta/io/packer.hpp>
+
+namespace kouta::benchmarks::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// @brief Obtain a unique path for a temporary file.
+        std::filesystem::path temp_path(const std::string& name)
+        {
+            return std::filesystem::temp_directory_path() / ("kouta-bench-" + name + "-" + std::to_string(::getpid()));
+        }
+
+        /// @brief Write a file of `count` bytes.
+        void make_file(const std::filesystem::path& path, std::size_t count)
+        {
+            std::ofstream out{path, std::ios::binary};
+            std::vector<char> data(count, 0x5A);
+
+            out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+    }  // namespace
+
+    /// @brief Read a whole file into a vector and checksum it.
+    void BM_FileRead(benchmark::State& state)
+    {
+        auto path{temp_path("read")};
+        auto count{static_cast<std::size_t>(state.range(0))};
+
+        make_file(path, count);
+
+        for (auto _ : state)
+        {
+            std::ifstream in{path, std::ios::binary};
+            std::vector<std::uint8_t> data(count);
+
+            in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(count));
+            benchmark::DoNotOptimize(checksum::Crc32c{}(std::span<const std::uint8_t>{data}));
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Map a whole file and checksum it.
+    void BM_FileMapped(benchmark::State& state)
+    {
+        auto path{temp_path("mapped")};
+
+        make_file(path, static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            MappedFile file{path};
+
+            file.advise(MappedFile::Advice::Sequential);
+            benchmark::DoNotOptimize(checksum::Crc32c{}(file.view()));
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Generate records in a Packer and write it to a file.
+    void BM_FileWritePacker(benchmark::State& state)
+    {
+        auto path{temp_path("write")};
+
+        for (auto _ : state)
+        {
+            Packer packer{};
+
+            for (std::int64_t i = 0; i < state.range(0); i++)
+            {
+                packer.insert_integral<std::uint64_t>(static_cast<std::uint64_t>(i));
+            }
+
+            std::ofstream out{path, std::ios::binary};
+
+            out.write(reinterpret_cast<const char*>(packer.data().data()), static_cast<std::streamsize>(packer.size()));
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Generate records directly in a mapped file.
+    void BM_FileWriteMapped(benchmark::State& state)
+    {
+        auto path{temp_path("write-mapped")};
+
+        for (auto _ : state)
+        {
+            MappedPacker packer{path};
+
+            for (std::int64_t i = 0; i < state.range(0); i++)
+            {
+                packer.insert_integral<std::uint64_t>(static_cast<std::uint64_t>(i));
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+        std::filesystem::remove(path);
+    }
+
+    BENCHMARK(BM_FileRead)->RangeMultiplier(16)->Range(1 << 16, 1 << 26);
+    BENCHMARK(BM_FileMapped)->RangeMultiplier(16)->Range(1 << 16, 1 << 26);
+    BENCHMARK(BM_FileWritePacker)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+    BENCHMARK(BM_FileWriteMapped)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+}  // namespace kouta::benchmarks::io
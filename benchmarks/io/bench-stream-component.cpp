@@ -0,0 +1,138 @@
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/base/callback.hpp>
+#include <kouta/base/root.hpp>
+#include <kouta/io/stream-component.hpp>
+
+namespace kouta::benchmarks::io
+{
+    using namespace kouta::io;
+    namespace asio = kouta::base::asio;
+
+    namespace
+    {
+        /// Number of frames sent in each iteration.
+        constexpr std::size_t BurstSize{64};
+
+        /// @brief Root that sends bursts of frames from one stream component to another.
+        template<class TStream>
+        class StreamRoot : public base::Root
+        {
+        public:
+            StreamRoot()
+                : base::Root{}
+                , sender{this,
+                         FrameDecoder::length_prefix<std::uint32_t>(),
+                         base::callback::DirectCallback<const Parser&>{[](const Parser&) {}},
+                         base::callback::DirectCallback{this, &StreamRoot::handle_error}}
+                , receiver{this,
+                           FrameDecoder::length_prefix<std::uint32_t>(),
+                           base::callback::DirectCallback{this, &StreamRoot::handle_frame},
+                           base::callback::DirectCallback{this, &StreamRoot::handle_error}}
+                , received{0}
+            {
+            }
+
+            /// @brief Send a burst of frames with the given payload size and wait for all of them.
+            void run_burst(std::size_t size)
+            {
+                received = 0;
+
+                for (std::size_t i = 0; i < BurstSize; i++)
+                {
+                    Packer packer{size + 4};
+                    packer.insert_integral(static_cast<std::uint32_t>(size));
+                    packer.insert_bytes(std::vector<std::uint8_t>(size, 0x42));
+                    sender.send(std::move(packer));
+                }
+
+                while (received < BurstSize)
+                {
+                    context().run_one();
+                }
+            }
+
+            TStream sender;
+            TStream receiver;
+            std::size_t received;
+
+        private:
+            void handle_frame(const Parser&)
+            {
+                received++;
+            }
+
+            void handle_error(const asio::error_code& ec)
+            {
+                throw asio::system_error{ec};
+            }
+        };
+
+        /// @brief Obtain the name of the Asio backend in use.
+        const char* backend_name()
+        {
+#if defined(ASIO_HAS_IO_URING_AS_DEFAULT) || defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+            return "io_uring";
+#elif defined(ASIO_HAS_EPOLL) || defined(BOOST_ASIO_HAS_EPOLL)
+            return "epoll";
+#else
+            return "reactor";
+#endif
+        }
+
+        /// @brief Benchmark the stream components over a connected pair.
+        template<class TStream, class TConnect>
+        void run_stream(benchmark::State& state, TConnect&& connect)
+        {
+            StreamRoot<TStream> root{};
+            auto size{static_cast<std::size_t>(state.range(0))};
+
+            connect(root);
+
+            root.receiver.start();
+            state.SetLabel(backend_name());
+
+            for (auto _ : state)
+            {
+                root.run_burst(size);
+            }
+
+            state.SetItemsProcessed(state.iterations() * BurstSize);
+            state.SetBytesProcessed(state.iterations() * BurstSize * (size + 4));
+        }
+    }  // namespace
+
+    void BM_StreamComponentSocketPair(benchmark::State& state)
+    {
+        using Stream = StreamComponent<asio::local::stream_protocol::socket>;
+
+        run_stream<Stream>(
+            state,
+            [](StreamRoot<Stream>& root)
+            {
+                asio::local::connect_pair(root.sender.stream(), root.receiver.stream());
+            });
+    }
+
+    void BM_StreamComponentTcp(benchmark::State& state)
+    {
+        using Stream = StreamComponent<asio::ip::tcp::socket>;
+
+        run_stream<Stream>(
+            state,
+            [](StreamRoot<Stream>& root)
+            {
+                asio::ip::tcp::acceptor acceptor{root.context(), {asio::ip::address_v4::loopback(), 0}};
+
+                root.sender.stream().connect(acceptor.local_endpoint());
+                acceptor.accept(root.receiver.stream());
+                root.sender.stream().set_option(asio::ip::tcp::no_delay{true});
+            });
+    }
+
+    BENCHMARK(BM_StreamComponentSocketPair)->RangeMultiplier(8)->Range(16, 1 << 14);
+    BENCHMARK(BM_StreamComponentTcp)->RangeMultiplier(8)->Range(16, 1 << 14);
+}  // namespace kouta::benchmarks::io
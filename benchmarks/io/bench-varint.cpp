@@ -0,0 +1,149 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/io/packer.hpp>
+#include <kouta/io/parser.hpp>
+
+namespace kouta::benchmarks::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// Number of values encoded/decoded per iteration.
+        constexpr std::size_t ValueCount{4096};
+
+        /// @brief Value distributions.
+        enum Distribution : std::int64_t
+        {
+            /// Telemetry-like counters: 90% below 128, 9% below 16384, 1% spread over 32 bits.
+            SmallCounters,
+            /// Uniformly spread over 32 bits.
+            Uniform,
+        };
+
+        std::vector<std::uint32_t> make_values(std::int64_t distribution)
+        {
+            std::mt19937 gen{42};
+            std::uniform_int_distribution<std::uint32_t> full{};
+            std::uniform_int_distribution<std::uint32_t> percent{0, 99};
+
+            std::vector<std::uint32_t> values(ValueCount);
+
+            for (auto& v : values)
+            {
+                if (distribution == Uniform)
+                {
+                    v = full(gen);
+                    continue;
+                }
+
+                auto p{percent(gen)};
+
+                if (p < 90)
+                {
+                    v = full(gen) % 128;
+                }
+                else if (p < 99)
+                {
+                    v = full(gen) % 16384;
+                }
+                else
+                {
+                    v = full(gen);
+                }
+            }
+
+            return values;
+        }
+
+        /// @brief Report the size of the encoded values versus their fixed-width representation.
+        void report_sizes(benchmark::State& state, std::size_t encoded_size)
+        {
+            state.counters["encoded_bytes_per_value"] = static_cast<double>(encoded_size) / ValueCount;
+            state.counters["fixed_bytes_per_value"] = sizeof(std::uint32_t);
+            state.counters["bytes_saved_pct"] =
+                100.0 * (1.0 - static_cast<double>(encoded_size) / (ValueCount * sizeof(std::uint32_t)));
+        }
+    }  // namespace
+
+    void BM_VarintEncode(benchmark::State& state)
+    {
+        auto values{make_values(state.range(0))};
+        Packer packer{ValueCount * varint::max_size<std::uint32_t>};
+
+        for (auto _ : state)
+        {
+            packer.data().clear();
+
+            for (auto v : values)
+            {
+                packer.insert_varint(v);
+            }
+
+            benchmark::DoNotOptimize(packer.data().data());
+        }
+
+        report_sizes(state, packer.size());
+        state.SetItemsProcessed(state.iterations() * ValueCount);
+    }
+
+    void BM_VarintDecode(benchmark::State& state)
+    {
+        auto values{make_values(state.range(0))};
+        Packer packer{};
+
+        for (auto v : values)
+        {
+            packer.insert_varint(v);
+        }
+
+        Parser parser{packer.data()};
+        std::vector<std::uint32_t> decoded(ValueCount);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(parser.extract_varints(0, std::span{decoded}));
+            benchmark::ClobberMemory();
+        }
+
+        report_sizes(state, packer.size());
+        state.SetItemsProcessed(state.iterations() * ValueCount);
+        state.SetBytesProcessed(state.iterations() * packer.size());
+    }
+
+    void BM_FixedDecode(benchmark::State& state)
+    {
+        auto values{make_values(state.range(0))};
+        Packer packer{};
+
+        for (auto v : values)
+        {
+            packer.insert_integral(v);
+        }
+
+        Parser parser{packer.data()};
+        std::vector<std::uint32_t> decoded(ValueCount);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < ValueCount; i++)
+            {
+                decoded[i] = parser.extract_integral<std::uint32_t>(i * sizeof(std::uint32_t));
+            }
+
+            benchmark::ClobberMemory();
+        }
+
+        report_sizes(state, packer.size());
+        state.SetItemsProcessed(state.iterations() * ValueCount);
+        state.SetBytesProcessed(state.iterations() * packer.size());
+    }
+
+    BENCHMARK(BM_VarintEncode)->Arg(SmallCounters)->Arg(Uniform);
+    BENCHMARK(BM_VarintDecode)->Arg(SmallCounters)->Arg(Uniform);
+    BENCHMARK(BM_FixedDecode)->Arg(SmallCounters)->Arg(Uniform);
+}  // namespace kouta::benchmarks::io
@@ -0,0 +1,111 @@
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/utils/enum-dispatcher.hpp>
+
+namespace kouta::benchmarks::utils
+{
+    using namespace kouta::utils;
+
+    namespace
+    {
+        enum class Message : std::size_t
+        {
+            A,
+            B,
+            C,
+            D,
+            E,
+            F,
+            G,
+            H,
+
+            _Total
+        };
+
+        /// @brief Target of the dispatch, accumulating the arguments.
+        class Handler
+        {
+        public:
+            void handle_a(std::uint64_t value)
+            {
+                sum += value;
+            }
+
+            void handle_b(std::uint64_t value)
+            {
+                sum ^= value;
+            }
+
+            std::uint64_t sum{0};
+
+            using Dispatcher = EnumDispatcher<Message,
+                                              Handler,
+                                              void(std::uint64_t),
+                                              Route<Message::A, &Handler::handle_a>,
+                                              Route<Message::B, &Handler::handle_b>,
+                                              Route<Message::C, &Handler::handle_a>,
+                                              Route<Message::D, &Handler::handle_b>,
+                                              Route<Message::E, &Handler::handle_a>,
+                                              Route<Message::F, &Handler::handle_b>,
+                                              Route<Message::G, &Handler::handle_a>,
+                                              Route<Message::H, &Handler::handle_b>>;
+        };
+    }  // namespace
+
+    /// @brief Dispatch through a hash map of type-erased handlers.
+    void BM_DispatchUnorderedMap(benchmark::State& state)
+    {
+        Handler handler{};
+        std::unordered_map<Message, std::function<void(std::uint64_t)>> handlers{};
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(Message::_Total); i++)
+        {
+            if (i % 2 == 0)
+            {
+                handlers[static_cast<Message>(i)] = [&handler](std::uint64_t value)
+                {
+                    handler.handle_a(value);
+                };
+            }
+            else
+            {
+                handlers[static_cast<Message>(i)] = [&handler](std::uint64_t value)
+                {
+                    handler.handle_b(value);
+                };
+            }
+        }
+
+        std::uint64_t i{0};
+
+        for (auto _ : state)
+        {
+            handlers.at(static_cast<Message>(i % 8))(i);
+            i++;
+        }
+
+        benchmark::DoNotOptimize(handler.sum);
+    }
+
+    /// @brief Dispatch through the jump table of an EnumDispatcher.
+    void BM_DispatchEnumDispatcher(benchmark::State& state)
+    {
+        Handler handler{};
+        std::uint64_t i{0};
+
+        for (auto _ : state)
+        {
+            Handler::Dispatcher::dispatch(handler, static_cast<Message>(i % 8), i);
+            i++;
+        }
+
+        benchmark::DoNotOptimize(handler.sum);
+    }
+
+    BENCHMARK(BM_DispatchUnorderedMap);
+    BENCHMARK(BM_DispatchEnumDispatcher);
+}  // namespace kouta::benchmarks::utils
@@ -0,0 +1,73 @@
+#include <bitset>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <kouta/utils/enum-set.hpp>
+
+namespace kouta::benchmarks::utils
+{
+    using namespace kouta::utils;
+
+    namespace
+    {
+        enum class Capability : std::size_t
+        {
+            First,
+
+            _Total = 256
+        };
+    }  // namespace
+
+    /// @brief Walk the members of a 256-entry set holding `state.range(0)` members by testing every bit.
+    void BM_EnumSetScan(benchmark::State& state)
+    {
+        std::bitset<256> set{};
+
+        for (std::int64_t i = 0; i < state.range(0); i++)
+        {
+            set.set(static_cast<std::size_t>(i * 256 / state.range(0)));
+        }
+
+        for (auto _ : state)
+        {
+            std::size_t sum{0};
+
+            for (std::size_t i = 0; i < set.size(); i++)
+            {
+                if (set[i])
+                {
+                    sum += i;
+                }
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    /// @brief Walk the members of a 256-entry set holding `state.range(0)` members through its iterator.
+    void BM_EnumSetIterate(benchmark::State& state)
+    {
+        EnumSet<Capability> set{};
+
+        for (std::int64_t i = 0; i < state.range(0); i++)
+        {
+            set.set(static_cast<std::size_t>(i * 256 / state.range(0)));
+        }
+
+        for (auto _ : state)
+        {
+            std::size_t sum{0};
+
+            for (auto value : set)
+            {
+                sum += static_cast<std::size_t>(value);
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    BENCHMARK(BM_EnumSetScan)->RangeMultiplier(4)->Range(1, 256);
+    BENCHMARK(BM_EnumSetIterate)->RangeMultiplier(4)->Range(1, 256);
+}  // namespace kouta::benchmarks::utils
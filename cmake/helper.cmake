@@ -11,6 +11,7 @@
 #
 # - TARGET: name of the target to generate, treated as a suffix
 # - HEADERS: list of headers relative to the include/kouta/ directory
+# - GENERATED: list of headers relative to the include/kouta/ directory of the build tree (see configure_file())
 # - SOURCES: list of sources relative to the src/ directory
 # - INTERNAL: list of internal components to link against
 # - LIBS: list of external libraries to link against
@@ -32,12 +33,14 @@
 #         base
 # )
 function(kouta_add_library)
-    cmake_parse_arguments(ARGS "" "TARGET" "HEADERS;SOURCES;INTERNAL;LIBS" ${ARGN})
+    cmake_parse_arguments(ARGS "" "TARGET" "HEADERS;GENERATED;SOURCES;INTERNAL;LIBS" ${ARGN})
 
     set(_lib_target "kouta-${ARGS_TARGET}")
     set(_header_target "${_lib_target}-header")
 
     list(TRANSFORM ARGS_HEADERS PREPEND "include/kouta/")
+    list(TRANSFORM ARGS_GENERATED PREPEND "${PROJECT_BINARY_DIR}/include/kouta/")
+    list(APPEND ARGS_HEADERS ${ARGS_GENERATED})
     list(TRANSFORM ARGS_SOURCES PREPEND "src/")
 
     # Static/Shared library
@@ -58,6 +61,7 @@ function(kouta_add_library)
     target_include_directories(${_lib_target}
         INTERFACE
         "$<BUILD_INTERFACE:${PROJECT_SOURCE_DIR}/include>"
+        "$<BUILD_INTERFACE:${PROJECT_BINARY_DIR}/include>"
     )
 
     # Internal links
@@ -81,6 +85,7 @@ function(kouta_add_library)
     target_include_directories(${_header_target}
         INTERFACE
         "$<BUILD_INTERFACE:${PROJECT_SOURCE_DIR}/include>"
+        "$<BUILD_INTERFACE:${PROJECT_BINARY_DIR}/include>"
     )
 
     if(ARGS_INTERNAL)
@@ -1,8 +1,15 @@
 #pragma once
 
+#include <kouta/base/arena.hpp>
 #include <kouta/base/asio.hpp>
 #include <kouta/base/branch.hpp>
 #include <kouta/base/callback.hpp>
+#include <kouta/base/channel.hpp>
+#include <kouta/base/component-handle.hpp>
 #include <kouta/base/component.hpp>
+#include <kouta/base/gate.hpp>
+#include <kouta/base/handle-table.hpp>
+#include <kouta/base/lanes.hpp>
+#include <kouta/base/message-bus.hpp>
 #include <kouta/base/root.hpp>
 #include <kouta/base/timer.hpp>
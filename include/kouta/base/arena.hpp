@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+#include <kouta/base/component.hpp>
+
+namespace kouta::base
+{
+    /// @brief Component that allocates its subtree in a monotonic buffer.
+    ///
+    /// @details
+    /// Children created through @ref make_child() under the Arena (or any of its descendants, unless they provide
+    /// their own memory resource) are allocated from a monotonic buffer, which obtains its memory in increasingly
+    /// larger chunks from the memory resource of the parent (e.g. the pool of the @ref Root).
+    ///
+    /// Deleting a component of the subtree does not release its memory. Instead, the whole buffer is released in one
+    /// step when the Arena is destroyed, which makes it suitable for short-lived subtrees (e.g. per connection).
+    ///
+    /// @warning Components allocated from the Arena must not be moved to another subtree that outlives it.
+    ///
+    /// @example
+    /// ```c++
+    /// auto* session{make_child<Arena>(this)};
+    ///
+    /// make_child<Connection>(session, std::move(socket));
+    /// make_child<Timer>(session, timeout, on_timeout);
+    ///
+    /// // Deletes the subtree and releases its memory at once
+    /// delete session;
+    /// ```
+    class Arena : public Component
+    {
+    public:
+        /// Default size of the first chunk of the buffer.
+        static constexpr std::size_t DefaultInitialSize{4096};
+
+        // Not default-constructible.
+        Arena() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] parent           Parent component. The lifetime of the parent must surpass that of the Arena.
+        /// @param[in] initial_size     Size of the first chunk of the buffer.
+        explicit Arena(Component* parent, std::size_t initial_size = DefaultInitialSize)
+            : Component{parent}
+            , m_buffer{initial_size, parent ? parent->memory_resource() : std::pmr::get_default_resource()}
+        {
+        }
+
+        // Not copyable
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        // Not movable
+        Arena(Arena&&) = delete;
+        Arena& operator=(Arena&&) = delete;
+
+        /// @brief Arena destructor.
+        ///
+        /// @details
+        /// Children are deleted before the buffer is released.
+        ~Arena() override
+        {
+            delete_children();
+        }
+
+        /// @brief Obtain the monotonic buffer of the Arena.
+        std::pmr::memory_resource* memory_resource() override
+        {
+            return &m_buffer;
+        }
+
+    private:
+        std::pmr::monotonic_buffer_resource m_buffer;
+    };
+}  // namespace kouta::base
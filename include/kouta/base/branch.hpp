@@ -1,5 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
 #include <thread>
 
 #include <kouta/base/component.hpp>
@@ -45,6 +50,8 @@ namespace kouta::base
         Branch(Component* parent, TArgs... args)
             : Root{parent}
             , m_worker{}
+            , m_drain_deadline{}
+            , m_dropped{0}
             , m_component{this, args...}  // Assuming first argument is the parent component
         {
         }
@@ -62,6 +69,8 @@ namespace kouta::base
         /// @details
         /// The destructor takes care of the cleanup of the worker thread, by stopping its event loop and waiting
         /// for the thread to terminate before joining it.
+        ///
+        /// @note Queued events are not executed (see @ref drain() for a graceful shutdown).
         virtual ~Branch()
         {
             if (m_worker.joinable())
@@ -97,6 +106,51 @@ namespace kouta::base
             }
         }
 
+        /// @brief Gracefully shut down the event loop of the worker thread and those of the subtree.
+        ///
+        /// @details
+        /// The subtree is drained first, from within the worker thread. Then, the gate of the Branch is closed, and
+        /// the worker executes the queued events until the queue is empty or the @p deadline is reached (see
+        /// @ref Root::drain()) before terminating. The worker thread is joined before returning.
+        ///
+        /// If the worker thread is not running, the Branch is drained from the calling thread instead.
+        ///
+        /// @note If the @p deadline is reached before the subtree is drained, it is drained (and its dropped events
+        /// counted) by the worker thread once the gate is closed, with the deadline already expired.
+        ///
+        /// @param[in] deadline         Time point after which queued events are dropped.
+        ///
+        /// @returns Number of events that were dropped (either rejected or discarded), including those of the subtree.
+        std::size_t drain(std::chrono::steady_clock::time_point deadline) override
+        {
+            if (!m_worker.joinable())
+            {
+                return Root::drain(deadline);
+            }
+
+            m_drain_deadline = deadline;
+
+            // The children list belongs to the worker thread. Posted without the gate, so that the subtree is drained
+            // even if the deadline is reached before it gets its turn
+            auto subtree{std::make_shared<std::promise<std::size_t>>()};
+            auto subtree_dropped{subtree->get_future()};
+
+            asio::post(context(),
+                       [this, deadline, subtree]()
+                       {
+                           subtree->set_value(Component::drain(deadline));
+                       });
+
+            subtree_dropped.wait_until(deadline);
+
+            gate()->close();
+            stop();
+            m_worker.join();
+
+            // Queued before the final pass of the worker (see Root::drain_queue()), hence always executed by now
+            return subtree_dropped.get() + m_dropped;
+        }
+
         /// @brief Post a wrapped component method call to the event loop for deferred execution.
         ///
         /// @details
@@ -127,11 +181,18 @@ namespace kouta::base
         /// @note This method blocks until the event loop is terminated.
         void run_worker()
         {
-            auto work_guard{asio::make_work_guard(context())};
-            context().run();
+            run_loop();
+
+            // Stopped by drain()
+            if (m_drain_deadline)
+            {
+                m_dropped = drain_queue(*m_drain_deadline);
+            }
         }
 
         std::thread m_worker;
+        std::optional<std::chrono::steady_clock::time_point> m_drain_deadline;
+        std::size_t m_dropped;
         WrappedComponent m_component;
     };
 }  // namespace kouta::base
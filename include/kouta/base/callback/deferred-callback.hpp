@@ -9,7 +9,8 @@ namespace kouta::base::callback
     /// @details
     /// A deferred Callback wraps a callable that is invoked within the destination object's thread, assuming that
     /// said object implements a `post()` method which allows the Callback to deferr the call to its event loop.
-    /// This is the case for the @ref Component based architecture of this library.
+    /// This is the case for the @ref Component based architecture of this library, in which the call is executed in
+    /// the strand of the destination component, if it enabled one.
     ///
     /// Because calling a deferred Callback posts an event to the destination's thread, **arguments passed to the
     /// callback must be copied during the call**, meaning that the following types of arguments should not be used
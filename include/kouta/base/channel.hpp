@@ -0,0 +1,231 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <kouta/base/callback.hpp>
+#include <kouta/base/component.hpp>
+
+namespace kouta::base
+{
+    /// @brief Single-producer single-consumer channel.
+    ///
+    /// @details
+    /// A Channel connects a producer thread to a consumer component through a bounded, lock-free ring buffer. The
+    /// channel is a child of the consumer, and items are delivered through a callback invoked from within the event
+    /// loop of the consumer.
+    ///
+    /// As opposed to posting each item to the event loop (see @ref Component::post()), sending an item does not
+    /// allocate memory nor lock the event loop queue. Instead, the consumer is only woken up (with a single post) when
+    /// it is not already scheduled to drain the channel, so that items sent in bursts are delivered in batches.
+    ///
+    /// @warning Only **one thread** may send items at a time, and the channel must outlive any drain posted to the
+    /// event loop of the consumer (e.g. by destroying it after stopping said event loop).
+    ///
+    /// @tparam T                   Type of the items.
+    template<class T>
+    class Channel : public Component
+    {
+    public:
+        /// Type of the items.
+        using Item = T;
+        /// Callback to invoke for each received item.
+        using OnReceived = Callback<const T&>;
+
+        /// Default capacity of the channel.
+        static constexpr std::size_t DefaultCapacity{1024};
+
+        // Not default-constructible.
+        Channel() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] parent           Consumer component, whose event loop receives the items.
+        /// @param[in] on_received      Callback to invoke for each received item.
+        /// @param[in] capacity         Maximum number of items in the channel (rounded up to a power of two).
+        Channel(Component* parent, OnReceived on_received, std::size_t capacity = DefaultCapacity)
+            : Component{parent}
+            , m_on_received{std::move(on_received)}
+            , m_mask{std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1}
+            , m_slots{std::make_unique<Slot[]>(m_mask + 1)}
+            , m_head{0}
+            , m_cached_tail{0}
+            , m_tail{0}
+            , m_cached_head{0}
+            , m_scheduled{false}
+        {
+        }
+
+        // Not copyable
+        Channel(const Channel&) = delete;
+        Channel& operator=(const Channel&) = delete;
+
+        // Not movable
+        Channel(Channel&&) = delete;
+        Channel& operator=(Channel&&) = delete;
+
+        ~Channel() override
+        {
+            // Destroy the items that were never delivered
+            auto head{m_head.load(std::memory_order_relaxed)};
+            auto tail{m_tail.load(std::memory_order_acquire)};
+
+            for (; head != tail; head++)
+            {
+                std::destroy_at(slot(head));
+            }
+        }
+
+        /// @brief Obtain the maximum number of items in the channel.
+        std::size_t capacity() const
+        {
+            return m_mask + 1;
+        }
+
+        /// @brief Try to send an item to the consumer.
+        ///
+        /// @note This may be called from any thread, as long as there is a single producer at a time.
+        ///
+        /// @param[in] item             Item to send.
+        ///
+        /// @returns Whether the item was sent (`false` if the channel is full).
+        /// @{
+        bool try_send(const T& item)
+        {
+            return emplace(item);
+        }
+
+        bool try_send(T&& item)
+        {
+            return emplace(std::move(item));
+        }
+        /// @}
+
+    private:
+        /// @brief Storage for an item.
+        struct Slot
+        {
+            alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        /// @brief Obtain a pointer to the item stored at the given index.
+        T* slot(std::size_t index)
+        {
+            return std::launder(reinterpret_cast<T*>(m_slots[index & m_mask].storage));
+        }
+
+        /// @brief Store an item in the ring and wake up the consumer if required.
+        template<class TItem>
+        bool emplace(TItem&& item)
+        {
+            auto tail{m_tail.load(std::memory_order_relaxed)};
+
+            if ((tail - m_cached_head) > m_mask)
+            {
+                m_cached_head = m_head.load(std::memory_order_acquire);
+
+                if ((tail - m_cached_head) > m_mask)
+                {
+                    return false;
+                }
+            }
+
+            std::construct_at(reinterpret_cast<T*>(m_slots[tail & m_mask].storage), std::forward<TItem>(item));
+            m_tail.store(tail + 1, std::memory_order_release);
+
+            if (!m_scheduled.exchange(true, std::memory_order_acq_rel))
+            {
+                schedule();
+            }
+
+            return true;
+        }
+
+        /// @brief Deliver the items in the ring.
+        ///
+        /// @details
+        /// At most @ref capacity() items are delivered in a single run, so that a busy producer cannot starve the rest
+        /// of the event loop. If items remain afterwards, another run is posted.
+        void drain()
+        {
+            // Acquire the items sent before clearing the flag, later items will schedule another run
+            m_scheduled.exchange(false, std::memory_order_acq_rel);
+
+            auto head{m_head.load(std::memory_order_relaxed)};
+            std::size_t delivered{0};
+
+            while (delivered < capacity())
+            {
+                if (head == m_cached_tail)
+                {
+                    m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+                    if (head == m_cached_tail)
+                    {
+                        break;
+                    }
+                }
+
+                T* item{slot(head)};
+
+                m_on_received(*item);
+                std::destroy_at(item);
+                m_head.store(++head, std::memory_order_release);
+                delivered++;
+            }
+
+            if (delivered == capacity() && !m_scheduled.exchange(true, std::memory_order_acq_rel))
+            {
+                schedule();
+            }
+        }
+
+        /// @brief Post a drain to the event loop of the consumer, once the flag has been set.
+        ///
+        /// @details
+        /// The drain is subject to the @ref Gate of the consumer, as any other post. If the gate rejects or drops it
+        /// (e.g. during a shutdown), the flag is cleared, so that later items attempt to schedule another drain
+        /// instead of waiting for one that will never run. Undelivered items are destroyed along with the channel.
+        void schedule()
+        {
+            auto* gate{this->gate()};
+
+            if (gate && !gate->admit())
+            {
+                m_scheduled.store(false, std::memory_order_release);
+                return;
+            }
+
+            asio::post(executor(),
+                       [this, gate]()
+                       {
+                           if (gate && !gate->proceed())
+                           {
+                               m_scheduled.store(false, std::memory_order_release);
+                               return;
+                           }
+
+                           drain();
+                       });
+        }
+
+        OnReceived m_on_received;
+        std::size_t m_mask;
+        std::unique_ptr<Slot[]> m_slots;
+
+        // Consumer side
+        alignas(64) std::atomic<std::size_t> m_head;
+        std::size_t m_cached_tail;
+
+        // Producer side
+        alignas(64) std::atomic<std::size_t> m_tail;
+        std::size_t m_cached_head;
+
+        alignas(64) std::atomic<bool> m_scheduled;
+    };
+}  // namespace kouta::base
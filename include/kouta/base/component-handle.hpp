@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <kouta/base/asio.hpp>
+#include <kouta/base/component.hpp>
+#include <kouta/base/gate.hpp>
+#include <kouta/base/handle-table.hpp>
+
+namespace kouta::base
+{
+    /// @brief Weak handle to a component that may be destroyed while events are pending.
+    ///
+    /// @details
+    /// A handle references a slot of the @ref HandleTable of the @ref Root of the component (its index and
+    /// generation), instead of owning the component. Events posted through the handle check, from within the event
+    /// loop of the component, that the generation of the slot is still the same before invoking it, and are dropped
+    /// otherwise. Hence, posting does not involve any shared ownership nor atomic operations. Events are subject to
+    /// the @ref Gate of the Root, and executed in the strand of the component (if enabled), as any other post.
+    ///
+    /// Handles are plain values that can be copied and posted from any thread. However, creating the first handle of
+    /// a component (which registers it in the table), as well as @ref get(), must be done from the thread of its event
+    /// loop (or before said loop is running). The @ref Root of the component must outlive its handles.
+    ///
+    /// @example
+    /// ```c++
+    /// ComponentHandle handle{connection};
+    ///
+    /// // Dropped if the connection has been deleted by the time the event is handled
+    /// handle.post(&Connection::send, data);
+    /// ```
+    ///
+    /// @tparam TComponent          Type of the component.
+    template<class TComponent>
+        requires std::is_base_of_v<Component, TComponent>
+    class ComponentHandle
+    {
+    public:
+        /// @brief Default constructor.
+        ///
+        /// @details
+        /// The handle does not reference any component.
+        ComponentHandle()
+            : m_table{nullptr}
+            , m_context{nullptr}
+            , m_gate{nullptr}
+            , m_strand{}
+            , m_index{HandleTable::InvalidIndex}
+            , m_generation{0}
+        {
+        }
+
+        /// @brief Constructor from a component.
+        ///
+        /// @details
+        /// The component is registered in the handle table of its @ref Root, unless it already was.
+        ///
+        /// @param[in] component        Component to reference.
+        ///
+        /// @throws std::logic_error if the component is not attached to a @ref Root.
+        explicit ComponentHandle(TComponent* component)
+            : ComponentHandle{}
+        {
+            Component* base{component};
+
+            if (!base->m_handle_table)
+            {
+                auto* table{base->handle_table()};
+
+                if (!table)
+                {
+                    throw std::logic_error("Component is not attached to a Root");
+                }
+
+                base->m_handle_table = table;
+                base->m_handle_index = table->acquire(base);
+            }
+
+            m_table = base->m_handle_table;
+            m_context = &base->context();
+            m_gate = base->m_gate;
+            m_strand = base->m_strand;
+            m_index = base->m_handle_index;
+            m_generation = m_table->generation(m_index);
+        }
+
+        // Copyable
+        ComponentHandle(const ComponentHandle&) = default;
+        ComponentHandle& operator=(const ComponentHandle&) = default;
+
+        // Movable
+        ComponentHandle(ComponentHandle&&) = default;
+        ComponentHandle& operator=(ComponentHandle&&) = default;
+
+        /// @brief Check whether the handle references a component (which may have been destroyed).
+        bool empty() const
+        {
+            return m_table == nullptr;
+        }
+
+        /// @brief Obtain the referenced component.
+        ///
+        /// @warning Must be called from the thread of the event loop of the component.
+        ///
+        /// @returns Pointer to the component, or `nullptr` if the handle is empty or the component was destroyed.
+        TComponent* get() const
+        {
+            if (!m_table)
+            {
+                return nullptr;
+            }
+
+            return static_cast<TComponent*>(m_table->lookup(m_index, m_generation));
+        }
+
+        /// @brief Post a method call to the event loop of the component, if it still exists when handled.
+        ///
+        /// @warning Arguments are **copied** before being passed to the event loop.
+        ///
+        /// @tparam TClass              Class whose method is going to be invoked (the component or a base of it).
+        /// @tparam TMethodArgs         Types of the arguments that the method accepts.
+        /// @tparam TArgs               Types of the arguments provided to the invocation.
+        ///
+        /// @param[in] method           Method to invoke. Its signature must match `void(TArgs...)`
+        /// @param[in] args             Arguments to invoke the method with.
+        template<class TClass, class... TMethodArgs, class... TArgs>
+            requires std::is_base_of_v<TClass, TComponent>
+        void post(void (TClass::*method)(TMethodArgs...), TArgs... args) const
+        {
+            if (!m_table || (m_gate && !m_gate->admit()))
+            {
+                return;
+            }
+
+            post_handler(
+                [slot = slot(), method, args...]()
+                {
+                    if (slot.gate && !slot.gate->proceed())
+                    {
+                        return;
+                    }
+
+                    if (auto* component{slot.get()})
+                    {
+                        (component->*method)(std::move(args)...);
+                    }
+                });
+        }
+
+        /// @brief Post a functor to the event loop of the component, if it still exists when handled.
+        ///
+        /// @tparam TFunctor            Functor type, invoked with a reference to the component.
+        ///
+        /// @param[in] functor          Functor to invoke.
+        template<class TFunctor>
+            requires std::is_invocable_v<TFunctor, TComponent&>
+        void post(TFunctor&& functor) const
+        {
+            if (!m_table || (m_gate && !m_gate->admit()))
+            {
+                return;
+            }
+
+            post_handler(
+                [slot = slot(), functor = std::forward<TFunctor>(functor)]() mutable
+                {
+                    if (slot.gate && !slot.gate->proceed())
+                    {
+                        return;
+                    }
+
+                    if (auto* component{slot.get()})
+                    {
+                        functor(*component);
+                    }
+                });
+        }
+
+        /// @brief Check whether two handles reference the same slot and generation.
+        bool operator==(const ComponentHandle& other) const
+        {
+            return m_table == other.m_table && m_index == other.m_index && m_generation == other.m_generation;
+        }
+
+    private:
+        /// @brief Part of the handle captured by the posted events (the strand is not needed once posted).
+        struct Slot
+        {
+            HandleTable* table;
+            Gate* gate;
+            std::uint32_t index;
+            std::uint32_t generation;
+
+            TComponent* get() const
+            {
+                return static_cast<TComponent*>(table->lookup(index, generation));
+            }
+        };
+
+        /// @brief Obtain the part of the handle captured by the posted events.
+        Slot slot() const
+        {
+            return Slot{m_table, m_gate, m_index, m_generation};
+        }
+
+        /// @brief Post a handler to the strand of the component, if enabled, or to its event loop otherwise.
+        template<class THandler>
+        void post_handler(THandler&& handler) const
+        {
+            if (m_strand)
+            {
+                asio::post(*m_strand, std::forward<THandler>(handler));
+            }
+            else
+            {
+                asio::post(m_context->get_executor(), std::forward<THandler>(handler));
+            }
+        }
+
+        HandleTable* m_table;
+        asio::io_context* m_context;
+        Gate* m_gate;
+        std::optional<Component::Strand> m_strand;
+        std::uint32_t m_index;
+        std::uint32_t m_generation;
+    };
+}  // namespace kouta::base
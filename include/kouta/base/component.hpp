@@ -1,20 +1,60 @@
 #pragma once
 
-#include <vector>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
 
 #include <kouta/base/asio.hpp>
+#include <kouta/base/gate.hpp>
+#include <kouta/base/handle-table.hpp>
+#include <kouta/base/lanes.hpp>
 
 namespace kouta::base
 {
+    class Component;
+
+    template<class TComponent>
+        requires std::is_base_of_v<Component, TComponent>
+    class ComponentHandle;
+
+    template<class TComponent, class... TArgs>
+        requires std::is_base_of_v<Component, TComponent>
+    TComponent* make_child(Component* parent, TArgs&&... args);
+
     /// @brief Base class for asynchronous components.
     ///
     /// @details
     /// A component provies access to the underlying event loop which, by default, belongs to the parent component.
     /// Moreover, specifying a parent will add the component to its children list and make sure that the component is
     /// deleted when the parent is destroyed (if the component was allocated on the heap).
+    ///
+    /// The children list is intrusive (each component links to its previous and next siblings), hence adding and
+    /// removing children takes constant time and does not allocate memory.
+    ///
+    /// Heap-allocated children may also be created through @ref make_child(), which obtains their memory from the
+    /// @ref memory_resource() of the parent (e.g. the pool of the @ref Root or an @ref Arena) instead of the global
+    /// heap. Either way, they are released with `delete`.
+    ///
+    /// When the event loop is run from several threads, the events of a component may be executed concurrently. A
+    /// component can opt into serialized execution by calling @ref enable_strand() from its constructor, in which
+    /// case all the events posted to it (including those of a @ref callback::DeferredCallback) are executed through
+    /// an `asio::strand`, which is shared by the children it creates afterwards.
+    ///
+    /// Events may also be posted with a @ref Priority, in which case they are queued in the @ref Lanes of the
+    /// @ref Root instead of directly in the event loop, so that high priority events are not delayed by a backlog of
+    /// lower priority ones.
     class Component
     {
     public:
+        /// @brief Strand used to serialize the execution of the events of a component.
+        using Strand = asio::strand<asio::io_context::executor_type>;
+
         // Not default-constructible.
         Component() = delete;
 
@@ -23,6 +63,19 @@ namespace kouta::base
         /// @param[in] parent           Parent component. The lifetime of the parent must surpass that of the child.
         explicit Component(Component* parent)
             : m_parent{parent}
+            , m_owner{nullptr}
+            , m_first_child{nullptr}
+            , m_last_child{nullptr}
+            , m_previous_sibling{nullptr}
+            , m_next_sibling{nullptr}
+            , m_resource{nullptr}
+            , m_allocation_size{0}
+            , m_allocation_alignment{0}
+            , m_handle_table{nullptr}
+            , m_handle_index{HandleTable::InvalidIndex}
+            , m_gate{parent ? parent->m_gate : nullptr}
+            , m_strand{parent ? parent->m_strand : std::nullopt}
+            , m_lanes{parent ? parent->m_lanes : nullptr}
         {
             if (m_parent)
             {
@@ -45,23 +98,19 @@ namespace kouta::base
         /// components were allocated in the heap, as stack-allocated ones will probably have been deleted automatically
         /// prior to calling this destructor.
         ///
-        /// In addition, once a component has deleted its children, it will remove itself from its parent.
+        /// In addition, once a component has deleted its children, it will invalidate its handles (if any) and remove
+        /// itself from its parent.
         ///
         /// @note Child deletion happens in reverse order.
         virtual ~Component()
         {
-            // Delete children
-            while (!m_children.empty())
-            {
-                // When deleted, children will remove themselves from this list
-                auto* component{m_children.back()};
-                delete component;
-            }
+            delete_children();
+            release_handle();
 
             // Delete from parent
-            if (m_parent)
+            if (m_owner)
             {
-                m_parent->remove_child(this);
+                m_owner->remove_child(this);
             }
         }
 
@@ -73,17 +122,134 @@ namespace kouta::base
             return m_parent->context();
         }
 
+        /// @brief Obtain the strand in which the events of the component are executed.
+        ///
+        /// @returns The strand, or `std::nullopt` if the events of the component may run concurrently.
+        const std::optional<Strand>& strand() const
+        {
+            return m_strand;
+        }
+
+        /// @brief Obtain the executor in which the events of the component are executed.
+        ///
+        /// @details
+        /// This is the strand of the component, if enabled, or the executor of the event loop otherwise. Asynchronous
+        /// operations should bind their completion handlers to it (see `asio::bind_executor()`).
+        asio::any_io_executor executor()
+        {
+            if (m_strand)
+            {
+                return *m_strand;
+            }
+
+            return context().get_executor();
+        }
+
+        /// @brief Delete a component, returning its memory to wherever it was allocated from.
+        ///
+        /// @details
+        /// Components created through @ref make_child() are returned to the memory resource they were allocated from,
+        /// while the rest are returned to the global heap.
+        static void operator delete(Component* component, std::destroying_delete_t)
+        {
+            destroy(component, std::nullopt);
+        }
+
+        /// @brief Delete an over-aligned component, returning its memory to wherever it was allocated from.
+        ///
+        /// @details
+        /// Selected instead of the overload above for components with new-extended alignment, which were allocated
+        /// with the aligned `operator new` when not created through @ref make_child().
+        static void operator delete(Component* component, std::destroying_delete_t, std::align_val_t alignment)
+        {
+            destroy(component, alignment);
+        }
+
+        /// @brief Obtain the memory resource used to allocate children through @ref make_child().
+        ///
+        /// @note By default, this memory resource comes from the parent component (or is the default memory resource
+        /// if there is no parent).
+        virtual std::pmr::memory_resource* memory_resource()
+        {
+            return m_parent ? m_parent->memory_resource() : std::pmr::get_default_resource();
+        }
+
+        /// @brief Obtain the table in which the handles of the component are registered.
+        ///
+        /// @note By default, this table comes from the parent component (or there is none if there is no parent).
+        virtual HandleTable* handle_table()
+        {
+            return m_parent ? m_parent->handle_table() : nullptr;
+        }
+
+        /// @brief Obtain the gate controlling the events posted to the component.
+        ///
+        /// @note The gate belongs to the @ref Root of the component (there is none if there is no Root).
+        Gate* gate() const
+        {
+            return m_gate;
+        }
+
+        /// @brief Obtain the priority lanes of the event loop of the component.
+        ///
+        /// @note The lanes belong to the @ref Root of the component (there are none if there is no Root).
+        Lanes* lanes() const
+        {
+            return m_lanes;
+        }
+
+        /// @brief Drain the event loops of the subtree of the component.
+        ///
+        /// @details
+        /// By default, the children are drained in reverse order (i.e. the same order in which they would be deleted),
+        /// which is expected to be the order of dependency: components are usually created after those they post
+        /// to. Components that own an event loop (see @ref Root::drain()) drain it after their subtree.
+        ///
+        /// @param[in] deadline         Time point after which queued events are dropped.
+        ///
+        /// @returns Number of events that were dropped (either rejected or discarded).
+        virtual std::size_t drain(std::chrono::steady_clock::time_point deadline)
+        {
+            std::size_t dropped{0};
+
+            for (auto* child{m_last_child}; child; child = child->m_previous_sibling)
+            {
+                dropped += child->drain(deadline);
+            }
+
+            return dropped;
+        }
+
         /// @brief Add a child component to the list.
         ///
         /// @details
         /// This is used to keep track of objects to delete when the component has been allocated in the heap.
         ///
         /// @note Normally, this will only be called from the Constructor of the component.
+        /// @note A component can only be in one list, hence it is removed from its current list, if any.
         ///
         /// @param[in] component            Pointer to the component to add.
         void add_child(Component* component)
         {
-            m_children.emplace_back(component);
+            if (component->m_owner)
+            {
+                component->m_owner->remove_child(component);
+            }
+
+            component->m_owner = this;
+            component->m_previous_sibling = m_last_child;
+            component->m_next_sibling = nullptr;
+
+            if (m_last_child)
+            {
+                m_last_child->m_next_sibling = component;
+            }
+            else
+            {
+                m_first_child = component;
+            }
+
+            m_last_child = component;
         }
 
         /// @brief Remove a child component from the list.
@@ -92,9 +258,36 @@ namespace kouta::base
         /// When a child is removed, the parent component will not attempt to delete it itself. Note that when a
         /// component allocated in the stack is destroyed, it will remove itself from the list and prevent
         /// double-free issues.
+        ///
+        /// @note Removing a component that is not in the list has no effect.
         void remove_child(Component* component)
         {
-            std::erase(m_children, component);
+            if (component->m_owner != this)
+            {
+                return;
+            }
+
+            if (component->m_previous_sibling)
+            {
+                component->m_previous_sibling->m_next_sibling = component->m_next_sibling;
+            }
+            else
+            {
+                m_first_child = component->m_next_sibling;
+            }
+
+            if (component->m_next_sibling)
+            {
+                component->m_next_sibling->m_previous_sibling = component->m_previous_sibling;
+            }
+            else
+            {
+                m_last_child = component->m_previous_sibling;
+            }
+
+            component->m_owner = nullptr;
+            component->m_previous_sibling = nullptr;
+            component->m_next_sibling = nullptr;
         }
 
         /// @brief Post a method call to the event loop for deferred execution.
@@ -114,8 +307,7 @@ namespace kouta::base
         template<class TClass, class... TMethodArgs, class... TArgs>
         void post(void (TClass::*method)(TMethodArgs...), TArgs... args)
         {
-            asio::post(
-                context().get_executor(),
+            post_gated(
                 [this, method, args...]()
                 {
                     (static_cast<TClass*>(this)->*method)(std::move(args)...);
@@ -138,8 +330,7 @@ namespace kouta::base
         template<class... TFuncArgs, class... TArgs>
         void post(const std::function<void(TFuncArgs...)>& functor, TArgs... args)
         {
-            asio::post(
-                context().get_executor(),
+            post_gated(
                 [functor, args...]()
                 {
                     functor(std::move(args)...);
@@ -158,11 +349,295 @@ namespace kouta::base
         template<class TFunctor>
         void post(TFunctor&& functor)
         {
-            asio::post(context().get_executor(), functor);
+            post_gated(std::forward<TFunctor>(functor));
+        }
+
+        /// @brief Post a method call to the lane of the given priority for deferred execution.
+        ///
+        /// @details
+        /// The call is queued in the @ref Lanes of the @ref Root, which are drained in weighted rounds, so that it is
+        /// executed before the events of lower priority that are already queued. Components without a Root post the
+        /// call directly to the event loop.
+        ///
+        /// @note For components with a strand, the priority determines when the call enters the strand.
+        ///
+        /// @warning Arguments are **copied** before being passed to the event loop.
+        ///
+        /// @tparam TPriority           Priority of the call.
+        /// @tparam TClass              Child class whose method is going to be invoked.
+        /// @tparam TMethodArgs         Types of the arguments that the method accepts.
+        /// @tparam TArgs               Types of the arguments provided to the invocation.
+        ///
+        /// @param[in] method           Method to invoke. Its signature must match `void(TArgs...)`
+        /// @param[in] args             Arguments to invoke the method with.
+        template<Priority TPriority, class TClass, class... TMethodArgs, class... TArgs>
+        void post(void (TClass::*method)(TMethodArgs...), TArgs... args)
+        {
+            post_laned(TPriority,
+                       [this, method, args...]()
+                       {
+                           (static_cast<TClass*>(this)->*method)(std::move(args)...);
+                       });
+        }
+
+        /// @brief Post a functor call to the lane of the given priority for deferred execution.
+        ///
+        /// @details
+        /// See the method overload for details.
+        ///
+        /// @tparam TPriority           Priority of the call.
+        /// @tparam TFunctor            Functor type.
+        ///
+        /// @param[in] functor          Functor to invoke.
+        template<Priority TPriority, class TFunctor>
+        void post(TFunctor&& functor)
+        {
+            post_laned(TPriority, std::forward<TFunctor>(functor));
+        }
+
+    protected:
+        /// @brief Execute the events of the component (and the children created afterwards) in a strand.
+        ///
+        /// @details
+        /// This serializes the execution of the events posted to the component, even if the event loop is run from
+        /// several threads. Components that do not enable a strand have their events executed in parallel.
+        ///
+        /// @note Must be called from the constructor, before any children, handles or subscriptions are created.
+        /// @note If the component already inherited the strand of its parent, the strand is kept.
+        void enable_strand()
+        {
+            if (!m_strand)
+            {
+                m_strand.emplace(asio::make_strand(context()));
+            }
+        }
+
+        /// @brief Execute the events of the component (and the children created afterwards) without a strand.
+        ///
+        /// @details
+        /// This allows children to opt out of the strand inherited from their parent, as well as components that own
+        /// their event loop (such as the @ref Root) to ignore that of their parent.
+        ///
+        /// @note Must be called from the constructor, before any children, handles or subscriptions are created.
+        void disable_strand()
+        {
+            m_strand.reset();
+        }
+
+        /// @brief Set the gate controlling the events posted to the component.
+        ///
+        /// @note Must be called before any children are created, as they inherit the gate of the parent.
+        void set_gate(Gate* gate)
+        {
+            m_gate = gate;
+        }
+
+        /// @brief Set the priority lanes of the event loop of the component.
+        ///
+        /// @note Must be called before any children are created, as they inherit the lanes of the parent.
+        void set_lanes(Lanes* lanes)
+        {
+            m_lanes = lanes;
+        }
+
+        /// @brief Delete the children of the component, in reverse order.
+        ///
+        /// @details
+        /// This is done automatically by the destructor, but must be called earlier by components that own the memory
+        /// resource of their children, so that the children are deleted before said resource is destroyed.
+        void delete_children()
+        {
+            while (m_last_child)
+            {
+                // When deleted, children will remove themselves from this list
+                delete m_last_child;
+            }
+        }
+
+        /// @brief Release the slot of the component in the handle table, invalidating its handles.
+        ///
+        /// @details
+        /// This is done automatically by the destructor, but must be called earlier by components that own the handle
+        /// table, so that the slot is released before said table is destroyed.
+        void release_handle()
+        {
+            if (m_handle_table)
+            {
+                m_handle_table->release(m_handle_index);
+                m_handle_table = nullptr;
+                m_handle_index = HandleTable::InvalidIndex;
+            }
         }
 
     private:
+        template<class TComponent, class... TArgs>
+            requires std::is_base_of_v<Component, TComponent>
+        friend TComponent* make_child(Component* parent, TArgs&&... args);
+
+        template<class TComponent>
+            requires std::is_base_of_v<Component, TComponent>
+        friend class ComponentHandle;
+
+        /// @brief Destroy a component and release its memory.
+        ///
+        /// @param[in] component        Component to destroy.
+        /// @param[in] alignment        Alignment of the dynamic type of the component, if new-extended.
+        static void destroy(Component* component, std::optional<std::align_val_t> alignment)
+        {
+            auto* resource{component->m_resource};
+            auto size{component->m_allocation_size};
+            auto allocation_alignment{component->m_allocation_alignment};
+            auto* memory{dynamic_cast<void*>(component)};
+
+            component->~Component();
+
+            if (resource)
+            {
+                resource->deallocate(memory, size, allocation_alignment);
+            }
+            else if (alignment)
+            {
+                ::operator delete(memory, *alignment);
+            }
+            else
+            {
+                ::operator delete(memory);
+            }
+        }
+
+        /// @brief Post a handler to the event loop, if admitted by the gate.
+        template<class THandler>
+        void post_gated(THandler&& handler)
+        {
+            if (!m_gate)
+            {
+                post_handler(std::forward<THandler>(handler));
+            }
+            else if (m_gate->admit())
+            {
+                post_handler(
+                    [gate = m_gate, handler = std::forward<THandler>(handler)]() mutable
+                    {
+                        if (gate->proceed())
+                        {
+                            handler();
+                        }
+                    });
+            }
+        }
+
+        /// @brief Queue a handler in the lane of the given priority, if admitted by the gate.
+        template<class THandler>
+        void post_laned(Priority priority, THandler&& handler)
+        {
+            if (!m_lanes)
+            {
+                post_gated(std::forward<THandler>(handler));
+            }
+            else if (!m_gate || m_gate->admit())
+            {
+                m_lanes->push(priority,
+                              [gate = m_gate, strand = m_strand, handler = std::forward<THandler>(handler)]() mutable
+                              {
+                                  if (gate && !gate->proceed())
+                                  {
+                                      return;
+                                  }
+
+                                  if (strand)
+                                  {
+                                      asio::dispatch(*strand, std::move(handler));
+                                  }
+                                  else
+                                  {
+                                      handler();
+                                  }
+                              });
+            }
+        }
+
+        /// @brief Post a handler to the strand of the component, if enabled, or to the event loop otherwise.
+        template<class THandler>
+        void post_handler(THandler&& handler)
+        {
+            if (m_strand)
+            {
+                asio::post(*m_strand, std::forward<THandler>(handler));
+            }
+            else
+            {
+                asio::post(context().get_executor(), std::forward<THandler>(handler));
+            }
+        }
+
         Component* m_parent;
-        std::vector<Component*> m_children;
+
+        // Intrusive children list
+        Component* m_owner;
+        Component* m_first_child;
+        Component* m_last_child;
+        Component* m_previous_sibling;
+        Component* m_next_sibling;
+
+        // Allocation performed by make_child()
+        std::pmr::memory_resource* m_resource;
+        std::size_t m_allocation_size;
+        std::size_t m_allocation_alignment;
+
+        // Slot in the handle table, registered by ComponentHandle
+        HandleTable* m_handle_table;
+        std::uint32_t m_handle_index;
+
+        // Gate of the Root
+        Gate* m_gate;
+
+        // Strand of the component (or of an ancestor), if enabled
+        std::optional<Strand> m_strand;
+
+        // Priority lanes of the Root
+        Lanes* m_lanes;
     };
+
+    /// @brief Create a heap-allocated child component using the memory resource of its parent.
+    ///
+    /// @details
+    /// The child is deleted by the parent (or with `delete`) as any other heap-allocated component, and its memory is
+    /// returned to the memory resource it was allocated from.
+    ///
+    /// @warning The memory resources of the @ref Root and the @ref Arena are not synchronized, hence children must be
+    /// created and deleted from the thread of their event loop (or before it is running).
+    ///
+    /// @tparam TComponent          Type of the component to create.
+    /// @tparam TArgs               Types of the additional arguments of its constructor.
+    ///
+    /// @param[in] parent           Parent component, passed as first argument to the constructor.
+    /// @param[in] args             Additional arguments of the constructor.
+    ///
+    /// @returns Pointer to the new component.
+    template<class TComponent, class... TArgs>
+        requires std::is_base_of_v<Component, TComponent>
+    TComponent* make_child(Component* parent, TArgs&&... args)
+    {
+        auto* resource{parent->memory_resource()};
+        auto* memory{resource->allocate(sizeof(TComponent), alignof(TComponent))};
+        TComponent* component{nullptr};
+
+        try
+        {
+            component = ::new (memory) TComponent(parent, std::forward<TArgs>(args)...);
+        }
+        catch (...)
+        {
+            resource->deallocate(memory, sizeof(TComponent), alignof(TComponent));
+            throw;
+        }
+
+        Component* base{component};
+
+        base->m_resource = resource;
+        base->m_allocation_size = sizeof(TComponent);
+        base->m_allocation_alignment = alignof(TComponent);
+
+        return component;
+    }
 }  // namespace kouta::base
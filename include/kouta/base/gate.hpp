@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <kouta/base/asio.hpp>
+
+namespace kouta::base
+{
+    /// @brief Admission control of the events posted to an event loop.
+    ///
+    /// @details
+    /// Each @ref Root owns a gate, which is shared by the components of its event loop and used to shut the loop down
+    /// gracefully (see @ref Root::drain()):
+    ///
+    /// - While **open**, every post is admitted and executed.
+    /// - While **closed**, posts from other threads are rejected, but those performed from within the event loop
+    ///   itself (e.g. follow-up work of a handler being drained) are still admitted. Queued events are executed.
+    /// - While **discarding**, queued events are dropped instead of executed.
+    ///
+    /// Checking the gate only involves a relaxed atomic load while it is open. The counters are only updated once the
+    /// gate has been closed, and may be updated from several threads if the event loop is run from several threads.
+    class Gate
+    {
+    public:
+        /// @brief State of the gate.
+        enum class State : std::uint8_t
+        {
+            Open,
+            Closed,
+            Discarding
+        };
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] context          Event loop whose events are controlled by the gate.
+        explicit Gate(asio::io_context& context)
+            : m_context{context}
+            , m_state{State::Open}
+            , m_rejected{0}
+            , m_dropped{0}
+        {
+        }
+
+        // Not copyable
+        Gate(const Gate&) = delete;
+        Gate& operator=(const Gate&) = delete;
+
+        // Not movable
+        Gate(Gate&&) = delete;
+        Gate& operator=(Gate&&) = delete;
+
+        /// @brief Obtain the state of the gate.
+        State state() const
+        {
+            return m_state.load(std::memory_order_acquire);
+        }
+
+        /// @brief Stop admitting posts from other threads.
+        void close()
+        {
+            m_state.store(State::Closed, std::memory_order_release);
+        }
+
+        /// @brief Drop the events that are executed from now on.
+        ///
+        /// @warning Must be called from the thread that runs the event loop (or while it is not running).
+        void discard()
+        {
+            m_state.store(State::Discarding, std::memory_order_release);
+        }
+
+        /// @brief Check whether an event can be posted, counting it as rejected otherwise.
+        bool admit()
+        {
+            auto state{m_state.load(std::memory_order_relaxed)};
+
+            if (state == State::Open || (state == State::Closed && m_context.get_executor().running_in_this_thread()))
+            {
+                return true;
+            }
+
+            m_rejected.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        /// @brief Check whether a queued event can be executed, counting it as dropped otherwise.
+        ///
+        /// @note Called from the threads that run the event loop.
+        bool proceed()
+        {
+            if (m_state.load(std::memory_order_relaxed) != State::Discarding)
+            {
+                return true;
+            }
+
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        /// @brief Obtain the number of posts that were rejected.
+        std::size_t rejected() const
+        {
+            return m_rejected.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Obtain the number of queued events that were dropped.
+        std::size_t dropped() const
+        {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        asio::io_context& m_context;
+        std::atomic<State> m_state;
+        std::atomic<std::size_t> m_rejected;
+        std::atomic<std::size_t> m_dropped;
+    };
+}  // namespace kouta::base
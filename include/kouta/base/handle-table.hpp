@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace kouta::base
+{
+    class Component;
+
+    /// @brief Table of generation-counted slots referencing components.
+    ///
+    /// @details
+    /// Each @ref Root owns a table, in which the components of its event loop are registered when a
+    /// @ref ComponentHandle is first created for them. A slot is identified by its index and its generation, which is
+    /// incremented when the component is destroyed, so that stale handles can be detected before the slot is reused.
+    ///
+    /// The table is not synchronized, as it is only meant to be accessed from the thread of the event loop of its
+    /// Root (or before said loop is running).
+    class HandleTable
+    {
+    public:
+        /// Index used to denote the absence of a slot.
+        static constexpr std::uint32_t InvalidIndex{std::numeric_limits<std::uint32_t>::max()};
+
+        /// @brief Default constructor.
+        HandleTable()
+            : m_slots{}
+            , m_free{InvalidIndex}
+            , m_size{0}
+        {
+        }
+
+        // Not copyable
+        HandleTable(const HandleTable&) = delete;
+        HandleTable& operator=(const HandleTable&) = delete;
+
+        // Not movable
+        HandleTable(HandleTable&&) = delete;
+        HandleTable& operator=(HandleTable&&) = delete;
+
+        /// @brief Register a component in a free slot.
+        ///
+        /// @param[in] component        Component to register.
+        ///
+        /// @returns Index of the slot.
+        std::uint32_t acquire(Component* component)
+        {
+            std::uint32_t index{m_free};
+
+            if (index == InvalidIndex)
+            {
+                index = static_cast<std::uint32_t>(m_slots.size());
+                m_slots.push_back(Slot{nullptr, 0, InvalidIndex});
+            }
+            else
+            {
+                m_free = m_slots[index].next_free;
+            }
+
+            m_slots[index].component = component;
+            m_size++;
+
+            return index;
+        }
+
+        /// @brief Release a slot, invalidating the handles that reference it.
+        ///
+        /// @param[in] index            Index of the slot.
+        void release(std::uint32_t index)
+        {
+            auto& slot{m_slots[index]};
+
+            slot.component = nullptr;
+            slot.generation++;
+            slot.next_free = m_free;
+
+            m_free = index;
+            m_size--;
+        }
+
+        /// @brief Obtain the current generation of a slot.
+        std::uint32_t generation(std::uint32_t index) const
+        {
+            return m_slots[index].generation;
+        }
+
+        /// @brief Obtain the component referenced by a slot.
+        ///
+        /// @param[in] index            Index of the slot.
+        /// @param[in] generation       Expected generation of the slot.
+        ///
+        /// @returns Pointer to the component, or `nullptr` if the generation does not match (i.e. the component was
+        ///          destroyed).
+        Component* lookup(std::uint32_t index, std::uint32_t generation) const
+        {
+            const auto& slot{m_slots[index]};
+
+            return (slot.generation == generation) ? slot.component : nullptr;
+        }
+
+        /// @brief Obtain the number of registered components.
+        std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /// @brief Obtain the number of slots in the table.
+        std::size_t capacity() const
+        {
+            return m_slots.size();
+        }
+
+    private:
+        struct Slot
+        {
+            Component* component;
+            std::uint32_t generation;
+            std::uint32_t next_free;
+        };
+
+        std::vector<Slot> m_slots;
+        std::uint32_t m_free;
+        std::size_t m_size;
+    };
+}  // namespace kouta::base
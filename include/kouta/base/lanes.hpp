@@ -0,0 +1,569 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <kouta/base/asio.hpp>
+
+namespace kouta::base
+{
+    /// @brief Priority of a posted event, which determines the lane it is queued in.
+    enum class Priority : std::uint8_t
+    {
+        High,
+        Normal,
+        Bulk
+    };
+
+    /// @brief Priority lanes of an event loop.
+    ///
+    /// @details
+    /// Each @ref Root owns a fixed set of lanes (one per @ref Priority), in which the events posted with a priority
+    /// (see @ref Component::post()) are queued. Lanes are drained in rounds: each round executes up to @ref weight()
+    /// events of each lane, from the highest priority to the lowest, and then yields to the event loop (so that I/O
+    /// completions, timers and events posted without a priority are executed in between rounds).
+    ///
+    /// In addition, the Root drains the high priority lane after each handler executed by its event loop (see
+    /// @ref expedite()), so that high priority events do not wait behind the handlers that are already queued in the
+    /// event loop (which is a FIFO). Hence, a high priority event waits, at most, for the handler or round in progress,
+    /// while lower priority lanes are guaranteed to advance in every round.
+    ///
+    /// Each lane is a lock-free ring of @ref Capacity reusable cells, in which handlers of up to @ref InlineSize bytes
+    /// are stored without allocating memory. Events that do not fit in the ring (because it is full) are queued in an
+    /// overflow queue, protected by a mutex, until the ring has been drained.
+    ///
+    /// Events may be pushed from any thread. Rounds are executed one at a time, even if the event loop is run from
+    /// several threads. If an event throws, the exception propagates to the event loop, and the remaining events are
+    /// executed in later rounds.
+    class Lanes
+    {
+    public:
+        /// @brief Number of lanes.
+        static constexpr std::size_t Count{3};
+
+        /// @brief Default number of events executed per round, for each lane.
+        static constexpr std::array<std::size_t, Count> DefaultWeights{16, 4, 1};
+
+        /// @brief Number of events each lane queues without locking nor allocating memory.
+        static constexpr std::size_t Capacity{128};
+
+        /// @brief Maximum size of the handlers stored within the lanes (larger ones are allocated on the heap).
+        static constexpr std::size_t InlineSize{96};
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] context          Event loop in which the events are executed.
+        explicit Lanes(asio::io_context& context)
+            : m_context{context}
+            , m_lanes{}
+            , m_weights{DefaultWeights}
+            , m_scheduled{false}
+            , m_busy{false}
+        {
+        }
+
+        // Not copyable
+        Lanes(const Lanes&) = delete;
+        Lanes& operator=(const Lanes&) = delete;
+
+        // Not movable
+        Lanes(Lanes&&) = delete;
+        Lanes& operator=(Lanes&&) = delete;
+
+        /// @brief Obtain the number of events of a lane executed per round.
+        std::size_t weight(Priority priority) const
+        {
+            return m_weights[index(priority)];
+        }
+
+        /// @brief Set the number of events of a lane executed per round.
+        ///
+        /// @warning Must be called before events are pushed concurrently (e.g. before the event loop is running).
+        ///
+        /// @param[in] priority         Lane to configure.
+        /// @param[in] weight           Number of events per round (at least one, so that the lane is not starved).
+        void set_weight(Priority priority, std::size_t weight)
+        {
+            m_weights[index(priority)] = weight > 0 ? weight : 1;
+        }
+
+        /// @brief Obtain the number of events queued in a lane.
+        ///
+        /// @note The result is approximate while events are pushed or executed concurrently.
+        std::size_t size(Priority priority) const
+        {
+            return m_lanes[index(priority)].size();
+        }
+
+        /// @brief Queue an event in a lane, scheduling a round if none is pending.
+        ///
+        /// @param[in] priority         Lane to queue the event in.
+        /// @param[in] handler          Handler to execute. Its signature must match `void()`.
+        template<class THandler>
+        void push(Priority priority, THandler&& handler)
+        {
+            m_lanes[index(priority)].push(std::forward<THandler>(handler));
+            schedule();
+        }
+
+        /// @brief Execute the queued high priority events right away (up to its weight), unless a round is in progress.
+        ///
+        /// @note Called by the @ref Root after each handler executed by its event loop.
+        void expedite()
+        {
+            auto& lane{m_lanes[index(Priority::High)]};
+
+            if (!lane.ready() || m_busy.exchange(true, std::memory_order_acquire))
+            {
+                return;
+            }
+
+            Defer guard{[this]()
+                        {
+                            release();
+                        }};
+
+            lane.execute(m_weights[index(Priority::High)]);
+        }
+
+        /// @brief Discard the queued events of all the lanes without executing them.
+        ///
+        /// @note Used when draining the event loop past its deadline (see @ref Root::drain()).
+        ///
+        /// @returns Number of events discarded.
+        std::size_t clear()
+        {
+            std::size_t count{0};
+
+            for (auto& lane : m_lanes)
+            {
+                count += lane.clear();
+            }
+
+            return count;
+        }
+
+    private:
+        /// @brief Invoke a function when leaving the scope, even if an exception is thrown.
+        template<class TFunction>
+        class Defer
+        {
+        public:
+            explicit Defer(TFunction function)
+                : m_function{std::move(function)}
+            {
+            }
+
+            // Not copyable
+            Defer(const Defer&) = delete;
+            Defer& operator=(const Defer&) = delete;
+
+            // Not movable
+            Defer(Defer&&) = delete;
+            Defer& operator=(Defer&&) = delete;
+
+            ~Defer()
+            {
+                m_function();
+            }
+
+        private:
+            TFunction m_function;
+        };
+
+        /// @brief Type-erased event (which, unlike `std::function`, may be move-only), stored inline if small enough.
+        class Event
+        {
+        public:
+            Event()
+                : m_storage{}
+                , m_invoke{nullptr}
+                , m_destroy{nullptr}
+            {
+            }
+
+            // Not copyable
+            Event(const Event&) = delete;
+            Event& operator=(const Event&) = delete;
+
+            // Not movable
+            Event(Event&&) = delete;
+            Event& operator=(Event&&) = delete;
+
+            ~Event()
+            {
+                reset();
+            }
+
+            /// @brief Store a handler, which must be invoked or discarded (see @ref reset()) before storing another.
+            template<class THandler>
+            void emplace(THandler&& handler)
+            {
+                using Handler = std::decay_t<THandler>;
+
+                if constexpr (sizeof(Handler) <= InlineSize && alignof(Handler) <= alignof(std::max_align_t))
+                {
+                    new (m_storage) Handler(std::forward<THandler>(handler));
+
+                    m_invoke = [](std::byte* storage)
+                    {
+                        (*std::launder(reinterpret_cast<Handler*>(storage)))();
+                    };
+                    m_destroy = [](std::byte* storage)
+                    {
+                        std::launder(reinterpret_cast<Handler*>(storage))->~Handler();
+                    };
+                }
+                else
+                {
+                    new (m_storage) Handler*(new Handler(std::forward<THandler>(handler)));
+
+                    m_invoke = [](std::byte* storage)
+                    {
+                        (**std::launder(reinterpret_cast<Handler**>(storage)))();
+                    };
+                    m_destroy = [](std::byte* storage)
+                    {
+                        delete *std::launder(reinterpret_cast<Handler**>(storage));
+                    };
+                }
+            }
+
+            /// @brief Invoke the stored handler.
+            void operator()()
+            {
+                m_invoke(m_storage);
+            }
+
+            /// @brief Destroy the stored handler, if any.
+            void reset()
+            {
+                if (auto* destroy{std::exchange(m_destroy, nullptr)})
+                {
+                    m_invoke = nullptr;
+                    destroy(m_storage);
+                }
+            }
+
+        private:
+            alignas(std::max_align_t) std::byte m_storage[InlineSize];
+            void (*m_invoke)(std::byte*);
+            void (*m_destroy)(std::byte*);
+        };
+
+        /// @brief Queue of a lane.
+        ///
+        /// @details
+        /// Bounded multi-producer ring, in which each cell carries a sequence number that tells whether it is free
+        /// (equal to the position being pushed) or holds an event (equal to said position plus one). Events are only
+        /// executed by the holder of the lanes (hence, there is a single consumer).
+        class Lane
+        {
+        public:
+            Lane()
+                : m_cells{std::make_unique<Cell[]>(Capacity)}
+                , m_enqueue{0}
+                , m_dequeue{0}
+                , m_mutex{}
+                , m_overflow{}
+                , m_overflowing{false}
+            {
+                for (std::size_t i = 0; i < Capacity; i++)
+                {
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            // Not copyable
+            Lane(const Lane&) = delete;
+            Lane& operator=(const Lane&) = delete;
+
+            // Not movable
+            Lane(Lane&&) = delete;
+            Lane& operator=(Lane&&) = delete;
+
+            /// @brief Queue an event, in the overflow queue if the ring is full or events already overflowed.
+            template<class THandler>
+            void push(THandler&& handler)
+            {
+                if (!m_overflowing.load(std::memory_order_acquire) && try_push<THandler>(handler))
+                {
+                    return;
+                }
+
+                auto event{std::make_unique<Event>()};
+                event->emplace(std::forward<THandler>(handler));
+
+                std::lock_guard lock{m_mutex};
+
+                m_overflow.push_back(std::move(event));
+                m_overflowing.store(true);
+            }
+
+            /// @brief Check whether an event is ready to be executed.
+            bool ready() const
+            {
+                auto position{m_dequeue.load(std::memory_order_relaxed)};
+
+                return m_cells[position % Capacity].sequence.load() == position + 1 || m_overflowing.load();
+            }
+
+            /// @brief Obtain the number of queued events.
+            std::size_t size() const
+            {
+                auto dequeue{m_dequeue.load(std::memory_order_relaxed)};
+                auto enqueue{m_enqueue.load(std::memory_order_relaxed)};
+
+                std::lock_guard lock{m_mutex};
+
+                return (enqueue > dequeue ? enqueue - dequeue : 0) + m_overflow.size();
+            }
+
+            /// @brief Execute up to @p count events, in the order they were queued.
+            ///
+            /// @note Must only be called by the holder of the lanes.
+            void execute(std::size_t count)
+            {
+                for (std::size_t i = 0; i < count && execute_one(); i++)
+                {
+                }
+            }
+
+            /// @brief Discard the queued events without executing them.
+            ///
+            /// @note Must only be called by the holder of the lanes (or while no events are executed).
+            ///
+            /// @returns Number of events discarded.
+            std::size_t clear()
+            {
+                std::size_t count{0};
+
+                while (auto* cell{front()})
+                {
+                    recycle(*cell);
+                    count++;
+                }
+
+                std::deque<std::unique_ptr<Event>> discarded{};
+
+                {
+                    std::lock_guard lock{m_mutex};
+
+                    discarded.swap(m_overflow);
+                    m_overflowing.store(false);
+                }
+
+                // Destroyed without the lock, as the handlers may own arbitrary objects
+                return count + discarded.size();
+            }
+
+        private:
+            /// @brief Cell of the ring.
+            struct Cell
+            {
+                std::atomic<std::size_t> sequence;
+                Event event;
+            };
+
+            /// @brief Queue an event in the ring, unless it is full.
+            ///
+            /// @returns Whether the event was queued (otherwise, @p handler is left untouched).
+            template<class THandler>
+            bool try_push(std::remove_reference_t<THandler>& handler)
+            {
+                auto position{m_enqueue.load(std::memory_order_relaxed)};
+                Cell* cell{nullptr};
+
+                while (true)
+                {
+                    cell = &m_cells[position % Capacity];
+
+                    auto sequence{cell->sequence.load(std::memory_order_acquire)};
+
+                    if (sequence == position)
+                    {
+                        if (m_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (sequence < position)
+                    {
+                        // Still holds the event pushed one lap before
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_enqueue.load(std::memory_order_relaxed);
+                    }
+                }
+
+                try
+                {
+                    cell->event.emplace(std::forward<THandler>(handler));
+                }
+                catch (...)
+                {
+                    // The cell is claimed, hence it must be published to keep the ring going
+                    cell->event.emplace([]() {});
+                    cell->sequence.store(position + 1);
+                    throw;
+                }
+
+                cell->sequence.store(position + 1);
+
+                return true;
+            }
+
+            /// @brief Obtain the cell at the front of the ring, if it holds an event.
+            Cell* front()
+            {
+                auto position{m_dequeue.load(std::memory_order_relaxed)};
+                auto& cell{m_cells[position % Capacity]};
+
+                return cell.sequence.load(std::memory_order_acquire) == position + 1 ? &cell : nullptr;
+            }
+
+            /// @brief Destroy the event of the cell at the front of the ring, and make the cell available again.
+            void recycle(Cell& cell)
+            {
+                auto position{m_dequeue.load(std::memory_order_relaxed)};
+
+                cell.event.reset();
+                m_dequeue.store(position + 1, std::memory_order_relaxed);
+                cell.sequence.store(position + Capacity, std::memory_order_release);
+            }
+
+            /// @brief Execute the next event, either from the ring or, once it is empty, from the overflow queue.
+            ///
+            /// @returns Whether an event was executed.
+            bool execute_one()
+            {
+                if (auto* cell{front()})
+                {
+                    // Recycled even if the event throws
+                    Defer recycled{[this, cell]()
+                                   {
+                                       recycle(*cell);
+                                   }};
+
+                    cell->event();
+                    return true;
+                }
+
+                if (!m_overflowing.load())
+                {
+                    return false;
+                }
+
+                std::unique_ptr<Event> event{};
+
+                {
+                    std::lock_guard lock{m_mutex};
+
+                    if (!m_overflow.empty())
+                    {
+                        event = std::move(m_overflow.front());
+                        m_overflow.pop_front();
+                    }
+
+                    if (m_overflow.empty())
+                    {
+                        m_overflowing.store(false);
+                    }
+                }
+
+                if (!event)
+                {
+                    return false;
+                }
+
+                (*event)();
+                return true;
+            }
+
+            std::unique_ptr<Cell[]> m_cells;
+            std::atomic<std::size_t> m_enqueue;
+            std::atomic<std::size_t> m_dequeue;
+            mutable std::mutex m_mutex;
+            std::deque<std::unique_ptr<Event>> m_overflow;
+            std::atomic<bool> m_overflowing;
+        };
+
+        /// @brief Obtain the index of a lane.
+        static constexpr std::size_t index(Priority priority)
+        {
+            return static_cast<std::size_t>(priority);
+        }
+
+        /// @brief Post a round to the event loop, unless one is already pending.
+        void schedule()
+        {
+            if (!m_scheduled.load() && !m_scheduled.exchange(true))
+            {
+                asio::post(m_context.get_executor(),
+                           [this]()
+                           {
+                               run_round();
+                           });
+            }
+        }
+
+        /// @brief Stop holding the lanes, and schedule another round if events remain.
+        ///
+        /// @note Invoked even if an event throws, so that the lanes keep being drained.
+        void release()
+        {
+            m_busy.store(false);
+
+            for (const auto& lane : m_lanes)
+            {
+                if (lane.ready())
+                {
+                    schedule();
+                    return;
+                }
+            }
+        }
+
+        /// @brief Execute up to the weight of each lane, and schedule another round if events remain.
+        ///
+        /// @details
+        /// If the lanes are already being held (by a round or @ref expedite() in another thread), the round is skipped,
+        /// as the holder schedules another one when done.
+        void run_round()
+        {
+            m_scheduled.store(false);
+
+            if (m_busy.exchange(true, std::memory_order_acquire))
+            {
+                return;
+            }
+
+            Defer guard{[this]()
+                        {
+                            release();
+                        }};
+
+            for (std::size_t lane = 0; lane < Count; lane++)
+            {
+                // Executed without any lock, as events may push further events
+                m_lanes[lane].execute(m_weights[lane]);
+            }
+        }
+
+        asio::io_context& m_context;
+        std::array<Lane, Count> m_lanes;
+        std::array<std::size_t, Count> m_weights;
+        std::atomic<bool> m_scheduled;
+        std::atomic<bool> m_busy;
+    };
+}  // namespace kouta::base
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <kouta/base/asio.hpp>
+#include <kouta/base/component.hpp>
+#include <kouta/base/gate.hpp>
+
+namespace kouta::base
+{
+    /// @brief Publish-subscribe bus in which topics are types.
+    ///
+    /// @details
+    /// Components subscribe to a topic (one of @p TTopics) by providing a handler, which is always invoked from within
+    /// the event loop of the subscriber. Subscribers are grouped by event loop (and strand, if enabled), so that
+    /// publishing a message posts a single event to each destination (which then invokes the handlers of all the
+    /// subscribers in said destination, in subscription order), regardless of the number of subscribers. The message
+    /// is copied once, and shared between the destinations. Deliveries are subject to the @ref Gate of each destination
+    /// loop as any other post.
+    ///
+    /// Subscribed methods are stored as (subscriber, method) pairs and invoked directly, while arbitrary handlers are
+    /// type-erased in a `std::function`.
+    ///
+    /// Messages may be published from any thread. However, subscriptions are expected to be set up (e.g. in the
+    /// constructor of the @ref Root) before messages are published concurrently, as they are not synchronized.
+    ///
+    /// The lifetime of the subscribers must be guaranteed to surpass that of their subscription, including any
+    /// deliveries that may still be pending in their event loop.
+    ///
+    /// @example
+    /// ```c++
+    /// struct Temperature
+    /// {
+    ///     double value;
+    /// };
+    ///
+    /// MessageBus<Temperature, Pressure> bus{this};
+    ///
+    /// bus.subscribe(&logger, &Logger::handle_temperature);
+    /// bus.subscribe<Temperature>(&branch.component(),
+    ///                            [](const Temperature& message)
+    ///                            {
+    ///                            });
+    ///
+    /// bus.publish(Temperature{21.5});
+    /// ```
+    ///
+    /// @tparam TTopics             Types of the messages that can be published (must be distinct and copyable).
+    template<class... TTopics>
+        requires(sizeof...(TTopics) > 0 && (std::is_copy_constructible_v<TTopics> && ...))
+    class MessageBus : public Component
+    {
+    public:
+        /// @brief Check whether a type is a topic of the bus.
+        template<class TTopic>
+        static constexpr bool HasTopic{(std::is_same_v<TTopic, TTopics> || ...)};
+
+        /// @brief Type of the handlers of a topic.
+        template<class TTopic>
+        using Handler = std::function<void(const TTopic&)>;
+
+        // Not default-constructible.
+        MessageBus() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] parent           Parent component. The lifetime of the parent must surpass that of the bus.
+        explicit MessageBus(Component* parent)
+            : Component{parent}
+            , m_topics{}
+        {
+        }
+
+        // Not copyable
+        MessageBus(const MessageBus&) = delete;
+        MessageBus& operator=(const MessageBus&) = delete;
+
+        // Not movable
+        MessageBus(MessageBus&&) = delete;
+        MessageBus& operator=(MessageBus&&) = delete;
+
+        ~MessageBus() override = default;
+
+        /// @brief Subscribe a component to a topic.
+        ///
+        /// @tparam TTopic              Topic to subscribe to.
+        ///
+        /// @param[in] subscriber       Subscribed component, whose event loop is used to invoke the handler.
+        /// @param[in] handler          Handler to invoke for each published message.
+        template<class TTopic>
+            requires HasTopic<TTopic>
+        void subscribe(Component* subscriber, Handler<TTopic> handler)
+        {
+            add(subscriber, Entry<TTopic>{subscriber, nullptr, std::move(handler)});
+        }
+
+        /// @brief Subscribe a component method to a topic.
+        ///
+        /// @details
+        /// The method is invoked directly on the subscriber, without any type-erased wrapper.
+        ///
+        /// @tparam TClass              Subscriber type.
+        /// @tparam TTopic              Topic to subscribe to.
+        ///
+        /// @param[in] subscriber       Subscribed component, whose event loop is used to invoke the method.
+        /// @param[in] method           Method to invoke for each published message.
+        template<class TClass, class TTopic>
+            requires HasTopic<TTopic> && std::is_base_of_v<Component, TClass>
+        void subscribe(TClass* subscriber, void (TClass::*method)(const TTopic&))
+        {
+            add(subscriber, Entry<TTopic>{subscriber, static_cast<Method<TTopic>>(method), nullptr});
+        }
+
+        /// @brief Remove all the subscriptions of a component to a topic.
+        ///
+        /// @details
+        /// Deliveries that are already pending in the event loop of the subscriber are not cancelled.
+        ///
+        /// @tparam TTopic              Topic to unsubscribe from.
+        ///
+        /// @param[in] subscriber       Subscribed component.
+        ///
+        /// @returns Number of subscriptions removed.
+        template<class TTopic>
+            requires HasTopic<TTopic>
+        std::size_t unsubscribe(Component* subscriber)
+        {
+            auto& groups{topic<TTopic>()};
+            std::size_t removed{0};
+
+            for (auto& group : groups)
+            {
+                auto entries{std::make_shared<Entries<TTopic>>(*group.entries)};
+
+                removed += std::erase_if(*entries,
+                                         [subscriber](const Entry<TTopic>& entry)
+                                         {
+                                             return entry.subscriber == subscriber;
+                                         });
+
+                group.entries = std::move(entries);
+            }
+
+            std::erase_if(groups,
+                          [](const Group<TTopic>& group)
+                          {
+                              return group.entries->empty();
+                          });
+
+            return removed;
+        }
+
+        /// @brief Obtain the number of subscriptions to a topic.
+        template<class TTopic>
+            requires HasTopic<TTopic>
+        std::size_t subscribers() const
+        {
+            std::size_t total{0};
+
+            for (const auto& group : topic<TTopic>())
+            {
+                total += group.entries->size();
+            }
+
+            return total;
+        }
+
+        /// @brief Obtain the number of destinations (event loops or strands) a message of a topic is posted to.
+        template<class TTopic>
+            requires HasTopic<TTopic>
+        std::size_t destinations() const
+        {
+            return topic<TTopic>().size();
+        }
+
+        /// @brief Publish a message to all the subscribers of its topic.
+        ///
+        /// @details
+        /// A single event is posted to each destination event loop (or strand).
+        ///
+        /// @param[in] message          Message to publish.
+        template<class TTopic>
+            requires HasTopic<std::remove_cvref_t<TTopic>>
+        void publish(TTopic&& message)
+        {
+            using Message = std::remove_cvref_t<TTopic>;
+
+            const auto& groups{topic<Message>()};
+
+            if (groups.empty())
+            {
+                return;
+            }
+
+            auto shared{std::make_shared<const Message>(std::forward<TTopic>(message))};
+
+            for (const auto& group : groups)
+            {
+                if (group.gate && !group.gate->admit())
+                {
+                    continue;
+                }
+
+                auto deliver{[gate = group.gate, entries = group.entries, shared]()
+                             {
+                                 if (gate && !gate->proceed())
+                                 {
+                                     return;
+                                 }
+
+                                 for (const auto& entry : *entries)
+                                 {
+                                     if (entry.method)
+                                     {
+                                         (entry.subscriber->*entry.method)(*shared);
+                                     }
+                                     else
+                                     {
+                                         entry.handler(*shared);
+                                     }
+                                 }
+                             }};
+
+                if (group.strand)
+                {
+                    asio::post(*group.strand, std::move(deliver));
+                }
+                else
+                {
+                    asio::post(group.context->get_executor(), std::move(deliver));
+                }
+            }
+        }
+
+    private:
+        /// @brief Subscribed method, as a method of the @ref Component base of the subscriber.
+        template<class TTopic>
+        using Method = void (Component::*)(const TTopic&);
+
+        /// @brief Subscription to a topic.
+        ///
+        /// @details
+        /// Either @p method or @p handler is set.
+        template<class TTopic>
+        struct Entry
+        {
+            Component* subscriber;
+            Method<TTopic> method;
+            Handler<TTopic> handler;
+        };
+
+        /// @brief Subscriptions to a topic, shared with the pending deliveries.
+        template<class TTopic>
+        using Entries = std::vector<Entry<TTopic>>;
+
+        /// @brief Subscriptions to a topic that share an event loop and strand.
+        template<class TTopic>
+        struct Group
+        {
+            asio::io_context* context;
+            std::optional<Component::Strand> strand;
+            Gate* gate;
+            std::shared_ptr<const Entries<TTopic>> entries;
+        };
+
+        /// @brief Add a subscription to the group of the event loop (and strand) of its subscriber.
+        template<class TTopic>
+        void add(Component* subscriber, Entry<TTopic> entry)
+        {
+            auto& groups{topic<TTopic>()};
+            auto* destination{&subscriber->context()};
+            const auto& strand{subscriber->strand()};
+            auto group{std::ranges::find_if(groups,
+                                            [destination, &strand](const Group<TTopic>& candidate)
+                                            {
+                                                return candidate.context == destination && candidate.strand == strand;
+                                            })};
+
+            if (group == groups.end())
+            {
+                Group<TTopic> created{destination, strand, subscriber->gate(), std::make_shared<Entries<TTopic>>()};
+
+                group = groups.insert(groups.end(), std::move(created));
+            }
+
+            // Copy on write, as deliveries may still be pending for the previous list
+            auto entries{std::make_shared<Entries<TTopic>>(*group->entries)};
+
+            entries->push_back(std::move(entry));
+            group->entries = std::move(entries);
+        }
+
+        /// @brief Obtain the subscriptions of a topic, grouped by event loop.
+        /// @{
+        template<class TTopic>
+        std::vector<Group<TTopic>>& topic()
+        {
+            return std::get<std::vector<Group<TTopic>>>(m_topics);
+        }
+
+        template<class TTopic>
+        const std::vector<Group<TTopic>>& topic() const
+        {
+            return std::get<std::vector<Group<TTopic>>>(m_topics);
+        }
+        /// @}
+
+        std::tuple<std::vector<Group<TTopics>>...> m_topics;
+    };
+}  // namespace kouta::base
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <memory_resource>
+
 #include <kouta/base/component.hpp>
 
 namespace kouta::base
@@ -9,6 +13,10 @@ namespace kouta::base
     /// @details
     /// As opposed to a regular @ref Component, the Root does own the event loop and is in charge of
     /// running it and acting as the entry-point to the rest of the application.
+    ///
+    /// The Root also owns a memory pool, from which the children created through @ref make_child() are allocated
+    /// (unless an @ref Arena is placed in between), the @ref HandleTable of the components in its event loop, the
+    /// @ref Gate used to shut said loop down gracefully (see @ref drain()) and the priority @ref Lanes of said loop.
     class Root : public Component
     {
     public:
@@ -31,7 +39,16 @@ namespace kouta::base
         explicit Root(Component* parent)
             : Component{parent}
             , m_context{}
+            , m_pool{}
+            , m_handles{}
+            , m_loop_gate{m_context}
+            , m_loop_lanes{m_context}
         {
+            set_gate(&m_loop_gate);
+            set_lanes(&m_loop_lanes);
+
+            // The strand of the parent belongs to another event loop
+            disable_strand();
         }
 
         // Not copyable
@@ -42,7 +59,15 @@ namespace kouta::base
         Root(Root&&) = delete;
         Root& operator=(Root&&) = delete;
 
-        virtual ~Root() = default;
+        /// @brief Root destructor.
+        ///
+        /// @details
+        /// Children are deleted before the memory pool and the handle table are destroyed.
+        virtual ~Root()
+        {
+            delete_children();
+            release_handle();
+        }
 
         /// @brief Obtain a reference to the underlying I/O context.
         ///
@@ -52,25 +77,131 @@ namespace kouta::base
             return m_context;
         }
 
+        /// @brief Obtain the memory pool of the Root.
+        ///
+        /// @note The pool is not synchronized.
+        std::pmr::memory_resource* memory_resource() override
+        {
+            return &m_pool;
+        }
+
+        /// @brief Obtain the handle table of the Root.
+        ///
+        /// @note The table is not synchronized.
+        HandleTable* handle_table() override
+        {
+            return &m_handles;
+        }
+
         /// @brief Run the event loop.
         ///
+        /// @details
+        /// This method may be called from several threads, in which case the events are executed in parallel, except
+        /// for those of components that enabled a strand (see @ref Component::enable_strand()).
+        ///
+        /// @warning The memory pool and the handle table are not synchronized, hence children must not be created or
+        /// deleted concurrently (e.g. from components that do not share a strand).
+        ///
         /// @note This method blocks until the event loop is terminated.
         virtual void run()
         {
-            // Have the event loop run forever
-            auto work_guard{asio::make_work_guard(m_context)};
-            m_context.run();
+            run_loop();
         }
 
         /// @brief Stop the event loop and exit.
         ///
         /// @note Under normal circumstances, this would only be called when terminating the application.
+        /// @note Queued events are not executed (see @ref drain() for a graceful shutdown).
         virtual void stop()
         {
             m_context.stop();
         }
 
+        /// @brief Gracefully shut down the event loop and those of the subtree.
+        ///
+        /// @details
+        /// The subtree is drained first (see @ref Component::drain()). Then, the gate of the Root is closed, so that
+        /// posts from other threads are rejected, and queued events are executed until the queue is empty or the
+        /// @p deadline is reached, after which the remaining events are dropped.
+        ///
+        /// Only the events posted through a component are gated. Handlers that are not (e.g. timer expirations or I/O
+        /// completions bound to the executor of a component) are still executed past the deadline if they were
+        /// already queued when it was reached, but those queued afterwards are left in the event loop without being
+        /// executed (and are not counted as dropped).
+        ///
+        /// @warning Must be called from the thread that owns the Root while its event loop is not running (e.g. after
+        /// @ref run() returns).
+        ///
+        /// @param[in] deadline         Time point after which queued events are dropped.
+        ///
+        /// @returns Number of events that were dropped (either rejected or discarded), including those of the subtree.
+        std::size_t drain(std::chrono::steady_clock::time_point deadline) override
+        {
+            auto dropped{Component::drain(deadline)};
+
+            m_loop_gate.close();
+
+            return dropped + drain_queue(deadline);
+        }
+
+    protected:
+        /// @brief Run the event loop until it is stopped.
+        ///
+        /// @details
+        /// Handlers are executed one at a time, so that the high priority lane is drained after each of them (see
+        /// @ref Lanes::expedite()).
+        void run_loop()
+        {
+            // Have the event loop run forever
+            auto work_guard{asio::make_work_guard(m_context)};
+
+            while (m_context.run_one() > 0)
+            {
+                m_loop_lanes.expedite();
+            }
+        }
+
+        /// @brief Execute the queued events until the queue is empty or the @p deadline is reached, and drop the rest.
+        ///
+        /// @details
+        /// Past the deadline, the events queued in the lanes are discarded and a final pass over the queue of the event
+        /// loop drops the gated events. The pass stops at a marker posted beforehand, so that it is bounded even if
+        /// ungated handlers keep queueing further work.
+        ///
+        /// @note Must be called from the thread that runs the event loop, once the gate has been closed.
+        ///
+        /// @returns Number of events of this event loop that were dropped (either rejected or discarded).
+        std::size_t drain_queue(std::chrono::steady_clock::time_point deadline)
+        {
+            m_context.restart();
+
+            while (std::chrono::steady_clock::now() < deadline && m_context.poll_one() > 0)
+            {
+            }
+
+            m_loop_gate.discard();
+
+            auto discarded{m_loop_lanes.clear()};
+            bool reached{false};
+
+            asio::post(m_context,
+                       [&reached]()
+                       {
+                           reached = true;
+                       });
+
+            while (!reached && m_context.poll_one() > 0)
+            {
+            }
+
+            return m_loop_gate.rejected() + m_loop_gate.dropped() + discarded;
+        }
+
     private:
         asio::io_context m_context;
+        std::pmr::unsynchronized_pool_resource m_pool;
+        HandleTable m_handles;
+        Gate m_loop_gate;
+        Lanes m_loop_lanes;
     };
 }  // namespace kouta::base
@@ -52,7 +52,7 @@ namespace kouta::base
             stop();
 
             m_timer.expires_after(m_duration);
-            m_timer.async_wait(std::bind_front(&Timer::handle_expiration, this));
+            m_timer.async_wait(asio::bind_executor(executor(), std::bind_front(&Timer::handle_expiration, this)));
         }
 
         /// @brief Stop the timer if it was running/being waited for.
@@ -1,4 +1,17 @@
 #pragma once
 
+#include <kouta/io/bit-order.hpp>
+#include <kouta/io/bit-packer.hpp>
+#include <kouta/io/bit-parser.hpp>
+#include <kouta/io/buffer-pool.hpp>
+#include <kouta/io/capture.hpp>
+#include <kouta/io/checksum.hpp>
+#include <kouta/io/compression.hpp>
+#include <kouta/io/datagram-component.hpp>
+#include <kouta/io/frame-decoder.hpp>
+#include <kouta/io/gather-packer.hpp>
+#include <kouta/io/mapped-file.hpp>
 #include <kouta/io/packer.hpp>
 #include <kouta/io/parser.hpp>
+#include <kouta/io/stream-component.hpp>
+#include <kouta/io/varint.hpp>
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace kouta::io
+{
+    /// @brief Order in which bit fields are laid out within a byte sequence.
+    enum class BitOrder
+    {
+        /// The first field occupies the most significant bits of the first byte (e.g. most network protocols).
+        msb_first,
+        /// The first field occupies the least significant bits of the first byte (e.g. DEFLATE, CAN signals).
+        lsb_first,
+    };
+}  // namespace kouta::io
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+
+#include <boost/endian.hpp>
+
+#include <kouta/io/bit-order.hpp>
+#include <kouta/io/packer.hpp>
+
+namespace kouta::io
+{
+    /// @brief Bit-level data packer.
+    ///
+    /// @details
+    /// This class allows adding fields of arbitrary bit width (e.g. 1-bit flags, 3-bit enumerations, 12-bit values) to
+    /// the byte sequence of a @ref Packer. Bits are gathered in a 64-bit accumulator, which is written to the packer
+    /// eight bytes at a time.
+    ///
+    /// Because of this, bits are only guaranteed to be in the packer once @ref align() has been called, which pads the
+    /// pending bits with zeros up to the next byte boundary. After that, the @ref Packer may be used directly again
+    /// (e.g. to insert byte-aligned fields), and the BitPacker may be reused afterwards.
+    ///
+    /// @note The BitPacker **does not own the packer**, whose lifetime must surpass that of the BitPacker.
+    ///
+    /// @tparam Order               Order in which bit fields are laid out.
+    template<BitOrder Order = BitOrder::msb_first>
+    class BitPacker
+    {
+    public:
+        // Not default-constructible.
+        BitPacker() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] packer           Packer to write the bits to.
+        explicit BitPacker(Packer& packer)
+            : m_packer{packer}
+            , m_accumulator{0}
+            , m_pending{0}
+        {
+        }
+
+        // Not copyable
+        BitPacker(const BitPacker&) = delete;
+        BitPacker& operator=(const BitPacker&) = delete;
+
+        // Not movable
+        BitPacker(BitPacker&&) = delete;
+        BitPacker& operator=(BitPacker&&) = delete;
+
+        virtual ~BitPacker() = default;
+
+        /// @brief Obtain a reference to the underlying packer.
+        Packer& packer()
+        {
+            return m_packer;
+        }
+
+        /// @brief Obtain the number of bits that have not been written to the packer yet.
+        std::size_t pending() const
+        {
+            return m_pending;
+        }
+
+        /// @brief Insert a bit field.
+        ///
+        /// @details
+        /// Only the @p count least significant bits of @p value are inserted, meaning that signed values are stored
+        /// in two's complement.
+        ///
+        /// @tparam TValue          Integral type of the value to insert.
+        ///
+        /// @param[in] value        Value to insert.
+        /// @param[in] count        Width of the field, in bits (up to 64).
+        ///
+        /// @throws std::invalid_argument when @p count is greater than 64.
+        template<std::integral TValue>
+        void insert_bits(TValue value, std::size_t count)
+        {
+            if (count > 64)
+            {
+                throw std::invalid_argument("bit field wider than 64 bits");
+            }
+
+            if (count == 0)
+            {
+                return;
+            }
+
+            std::uint64_t bits{static_cast<std::uint64_t>(value) & mask(count)};
+
+            if constexpr (Order == BitOrder::msb_first)
+            {
+                if ((m_pending + count) < 64)
+                {
+                    m_accumulator = (m_accumulator << count) | bits;
+                    m_pending += count;
+
+                    return;
+                }
+
+                // Fill the accumulator with the most significant bits of the field
+                std::size_t free{64 - m_pending};
+
+                m_accumulator = (free == 64) ? bits : ((m_accumulator << free) | (bits >> (count - free)));
+                m_packer.insert_integral<std::uint64_t, 8, Packer::Order::big>(m_accumulator);
+
+                m_pending = count - free;
+                m_accumulator = bits & mask(m_pending);
+            }
+            else
+            {
+                m_accumulator |= bits << m_pending;
+
+                if ((m_pending + count) < 64)
+                {
+                    m_pending += count;
+
+                    return;
+                }
+
+                m_packer.insert_integral<std::uint64_t, 8, Packer::Order::little>(m_accumulator);
+
+                // Keep the most significant bits of the field that did not fit
+                std::size_t free{64 - m_pending};
+
+                m_accumulator = (free == 64) ? 0 : (bits >> free);
+                m_pending = count - free;
+            }
+        }
+
+        /// @brief Insert a single bit.
+        ///
+        /// @param[in] value        Value to insert.
+        void insert_bit(bool value)
+        {
+            insert_bits(static_cast<std::uint8_t>(value), 1);
+        }
+
+        /// @brief Write the pending bits to the packer, padding them with zeros up to the next byte boundary.
+        ///
+        /// @note This must be called before accessing the contents of the packer.
+        void align()
+        {
+            if (m_pending == 0)
+            {
+                return;
+            }
+
+            std::uint8_t buf[8];
+            std::size_t bytes{(m_pending + 7) / 8};
+
+            if constexpr (Order == BitOrder::msb_first)
+            {
+                // Move the pending bits to the most significant end
+                boost::endian::store_big_u64(buf, m_accumulator << (64 - m_pending));
+            }
+            else
+            {
+                boost::endian::store_little_u64(buf, m_accumulator);
+            }
+
+            m_packer.insert_bytes(buf, buf + bytes);
+
+            m_accumulator = 0;
+            m_pending = 0;
+        }
+
+    private:
+        /// @brief Obtain a mask for the @p count least significant bits.
+        static constexpr std::uint64_t mask(std::size_t count)
+        {
+            return (count >= 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << count) - 1);
+        }
+
+        Packer& m_packer;
+        std::uint64_t m_accumulator;
+        std::size_t m_pending;
+    };
+}  // namespace kouta::io
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include <boost/endian.hpp>
+
+#include <kouta/io/bit-order.hpp>
+#include <kouta/io/parser.hpp>
+
+namespace kouta::io
+{
+    /// @brief Bit-level data parser.
+    ///
+    /// @details
+    /// This class exposes a read-only API that facilitates extracting fields of arbitrary bit width from a byte
+    /// sequence. Fields are read with 64-bit loads rather than bit by bit.
+    ///
+    /// Just like the @ref Parser, it is backed by @ref std::span, meaning that a BitParser can be cheaply created over
+    /// a byte-aligned region of an existing @ref Parser (see @ref Parser::extract_bytes()).
+    ///
+    /// @note The parser **does not own the memory**, hence it is **not thread-safe**.
+    ///
+    /// @tparam Order               Order in which bit fields are laid out.
+    template<BitOrder Order = BitOrder::msb_first>
+    class BitParser
+    {
+    public:
+        /// Underlying view data type.
+        using View = Parser::View;
+
+        // Not default-constructible.
+        BitParser() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] view           View from which to construct the parser.
+        explicit BitParser(const View& view)
+            : m_view{view}
+        {
+        }
+
+        /// @brief Construct from a byte-level parser.
+        ///
+        /// @param[in] parser         Parser whose view will be used.
+        explicit BitParser(const Parser& parser)
+            : m_view{parser.view()}
+        {
+        }
+
+        // Copyable
+        BitParser(const BitParser&) = default;
+        BitParser& operator=(const BitParser&) = default;
+
+        // Movable
+        BitParser(BitParser&&) = default;
+        BitParser& operator=(BitParser&&) = default;
+
+        virtual ~BitParser() = default;
+
+        /// @brief Obtain a reference to the internal data view.
+        const View& view() const
+        {
+            return m_view;
+        }
+
+        /// @brief Obtain the size of the internal data view, in bits.
+        std::size_t bit_size() const
+        {
+            return m_view.size_bytes() * 8;
+        }
+
+        /// @brief Extract a bit field from the view.
+        ///
+        /// @details
+        /// The field starting at @p bit_offset and spanning @p count bits must be within bounds. Otherwise, an
+        /// @ref std::out_of_range exception will be thrown.
+        ///
+        /// Signed types are sign-extended from the most significant bit of the field.
+        ///
+        /// @tparam TValue          The numerical type to extract from the data view.
+        ///
+        /// @param[in] bit_offset   The offset, in bits, from which to start extracting data.
+        /// @param[in] count        Width of the field, in bits (up to 64).
+        ///
+        /// @returns Integral value
+        ///
+        /// @throws std::invalid_argument when @p count is greater than 64.
+        /// @throws std::out_of_range when there are not enough bits in the data view.
+        template<std::integral TValue = std::uint64_t>
+        TValue extract_bits(std::size_t bit_offset, std::size_t count) const
+        {
+            if (count > 64)
+            {
+                throw std::invalid_argument("bit field wider than 64 bits");
+            }
+
+            if ((bit_offset + count) > bit_size())
+            {
+                throw std::out_of_range("not enough bits to extract");
+            }
+
+            if (count == 0)
+            {
+                return TValue{0};
+            }
+
+            std::size_t byte{bit_offset / 8};
+            std::size_t shift{bit_offset % 8};
+            std::uint64_t word{load(byte)};
+            std::uint64_t bits{};
+
+            if constexpr (Order == BitOrder::msb_first)
+            {
+                bits = (word << shift) >> (64 - count);
+
+                if ((shift + count) > 64)
+                {
+                    // The field spills into a ninth byte
+                    std::size_t extra{shift + count - 64};
+
+                    bits |= m_view[byte + 8] >> (8 - extra);
+                }
+            }
+            else
+            {
+                bits = word >> shift;
+
+                if ((shift + count) > 64)
+                {
+                    // The field spills into a ninth byte
+                    bits |= std::uint64_t{m_view[byte + 8]} << (64 - shift);
+                }
+
+                bits &= (count == 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << count) - 1);
+            }
+
+            if constexpr (std::is_signed_v<TValue>)
+            {
+                if (count < 64)
+                {
+                    // Sign-extend
+                    std::uint64_t sign{std::uint64_t{1} << (count - 1)};
+
+                    bits = (bits ^ sign) - sign;
+                }
+            }
+
+            return static_cast<TValue>(bits);
+        }
+
+        /// @brief Extract a single bit from the view.
+        ///
+        /// @param[in] bit_offset   The offset, in bits, of the bit to extract.
+        ///
+        /// @returns Value of the bit.
+        ///
+        /// @throws std::out_of_range when the offset is not within the data view.
+        bool extract_bit(std::size_t bit_offset) const
+        {
+            return extract_bits<std::uint8_t>(bit_offset, 1) != 0;
+        }
+
+    private:
+        /// @brief Load up to 8 bytes starting at @p byte, padding with zeros past the end of the view.
+        std::uint64_t load(std::size_t byte) const
+        {
+            std::uint8_t buf[8]{};
+            const std::uint8_t* src{m_view.data() + byte};
+
+            if ((byte + 8) > m_view.size())
+            {
+                std::copy(src, m_view.data() + m_view.size(), buf);
+                src = buf;
+            }
+
+            if constexpr (Order == BitOrder::msb_first)
+            {
+                return boost::endian::load_big_u64(src);
+            }
+            else
+            {
+                return boost::endian::load_little_u64(src);
+            }
+        }
+
+        View m_view;
+    };
+}  // namespace kouta::io
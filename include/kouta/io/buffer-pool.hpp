@@ -0,0 +1,637 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <kouta/io/parser.hpp>
+
+namespace kouta::io
+{
+    class BufferPool;
+
+    namespace detail
+    {
+        /// Size of a cache line, used to align the blocks.
+        inline constexpr std::size_t CacheLineSize{64};
+
+        /// @brief Header placed right before the data of each block.
+        struct alignas(CacheLineSize) BlockHeader
+        {
+            /// Number of slices referencing the block.
+            std::atomic<std::uint32_t> refs;
+            /// Pool the block belongs to.
+            BufferPool* pool;
+            /// Next block in a free list.
+            BlockHeader* next;
+        };
+    }  // namespace detail
+
+    /// @brief Reference-counted view over (a part of) a block allocated from a @ref BufferPool.
+    ///
+    /// @details
+    /// Slices are cheap to copy: copying a slice only increments the reference count of the underlying block, which is
+    /// returned to the pool once the last slice referencing it is destroyed. This allows handing payloads over to
+    /// other components (e.g. through a `DeferredCallback<BufferSlice>`) without copying them.
+    ///
+    /// @note The reference count is atomic, so slices referencing the same block may be copied and destroyed from
+    /// different threads. However, a single slice object is **not thread-safe**, and concurrent writes to the data
+    /// must be synchronized externally.
+    class BufferSlice
+    {
+    public:
+        /// @brief Default constructor.
+        ///
+        /// @details
+        /// Creates an empty slice that does not reference any block.
+        BufferSlice()
+            : m_block{nullptr}
+            , m_offset{0}
+            , m_size{0}
+        {
+        }
+
+        /// @brief Copy constructor (shares the block).
+        BufferSlice(const BufferSlice& other)
+            : m_block{other.m_block}
+            , m_offset{other.m_offset}
+            , m_size{other.m_size}
+        {
+            acquire();
+        }
+
+        /// @brief Copy assignment (shares the block).
+        BufferSlice& operator=(const BufferSlice& other)
+        {
+            if (this != &other)
+            {
+                other.acquire();
+                release();
+
+                m_block = other.m_block;
+                m_offset = other.m_offset;
+                m_size = other.m_size;
+            }
+
+            return *this;
+        }
+
+        /// @brief Move constructor.
+        BufferSlice(BufferSlice&& other) noexcept
+            : m_block{std::exchange(other.m_block, nullptr)}
+            , m_offset{std::exchange(other.m_offset, 0)}
+            , m_size{std::exchange(other.m_size, 0)}
+        {
+        }
+
+        /// @brief Move assignment.
+        BufferSlice& operator=(BufferSlice&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+
+                m_block = std::exchange(other.m_block, nullptr);
+                m_offset = std::exchange(other.m_offset, 0);
+                m_size = std::exchange(other.m_size, 0);
+            }
+
+            return *this;
+        }
+
+        ~BufferSlice()
+        {
+            release();
+        }
+
+        /// @brief Obtain a writable view over the data of the slice.
+        std::span<std::uint8_t> data() const
+        {
+            return {begin(), m_size};
+        }
+
+        /// @brief Obtain a read-only view over the data of the slice.
+        Parser::View view() const
+        {
+            return {begin(), m_size};
+        }
+
+        /// @brief Obtain a parser over the data of the slice.
+        Parser parser() const
+        {
+            return Parser{view()};
+        }
+
+        /// @brief Obtain the size of the slice.
+        std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /// @brief Check whether the slice is empty.
+        bool empty() const
+        {
+            return m_size == 0;
+        }
+
+        /// @brief Obtain the number of slices referencing the same block (zero if there is no block).
+        std::uint32_t use_count() const
+        {
+            return m_block ? m_block->refs.load(std::memory_order_relaxed) : 0;
+        }
+
+        /// @brief Obtain a slice over a part of this slice, sharing the same block.
+        ///
+        /// @param[in] offset           Offset of the new slice within this slice.
+        /// @param[in] count            Size of the new slice.
+        ///
+        /// @returns New slice.
+        ///
+        /// @throws std::out_of_range if the range is not within the slice.
+        BufferSlice subslice(std::size_t offset, std::size_t count) const
+        {
+            if (offset > m_size || count > (m_size - offset))
+            {
+                throw std::out_of_range("range not within slice");
+            }
+
+            acquire();
+
+            return BufferSlice{m_block, m_offset + offset, count};
+        }
+
+        /// @brief Obtain a slice over the first @p count bytes of this slice, sharing the same block.
+        ///
+        /// @throws std::out_of_range if @p count exceeds the size of the slice.
+        BufferSlice first(std::size_t count) const
+        {
+            return subslice(0, count);
+        }
+
+        /// @brief Split the slice in two at the given offset.
+        ///
+        /// @details
+        /// This slice is shrunk to the first @p offset bytes, and the remaining bytes are returned as a new slice
+        /// sharing the same block.
+        ///
+        /// @param[in] offset           Offset at which to split the slice.
+        ///
+        /// @returns Slice over the bytes after @p offset.
+        ///
+        /// @throws std::out_of_range if @p offset exceeds the size of the slice.
+        BufferSlice split(std::size_t offset)
+        {
+            auto tail{subslice(offset, m_size - offset)};
+
+            m_size = offset;
+
+            return tail;
+        }
+
+    private:
+        friend class BufferPool;
+
+        /// @brief Construct from a block whose reference count has already been incremented.
+        BufferSlice(detail::BlockHeader* block, std::size_t offset, std::size_t size)
+            : m_block{block}
+            , m_offset{offset}
+            , m_size{size}
+        {
+        }
+
+        /// @brief Obtain a pointer to the first byte of the slice.
+        std::uint8_t* begin() const
+        {
+            if (!m_block)
+            {
+                return nullptr;
+            }
+
+            return reinterpret_cast<std::uint8_t*>(m_block + 1) + m_offset;
+        }
+
+        /// @brief Increment the reference count of the block, if any.
+        void acquire() const
+        {
+            if (m_block)
+            {
+                m_block->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        /// @brief Decrement the reference count of the block, if any, returning it to the pool if unused.
+        inline void release();
+
+        detail::BlockHeader* m_block;
+        std::size_t m_offset;
+        std::size_t m_size;
+    };
+
+    /// @brief Pool of fixed-size, cache-line-aligned memory blocks.
+    ///
+    /// @details
+    /// Blocks are allocated in chunks and handed out as @ref BufferSlice objects. Once the last slice referencing a
+    /// block is destroyed, the block is returned to a free list local to the thread that destroyed it, so that
+    /// allocating and releasing blocks does not require any locking in the common case. When a thread-local list
+    /// grows too large, half of it is moved to a central free list (protected by a mutex) from which other threads
+    /// can refill their own lists.
+    ///
+    /// The blocks held in the free list of a thread are returned to the central free list when the thread exits. The
+    /// free lists of a thread that belong to destroyed pools are discarded the next time the thread creates a free
+    /// list for another pool, so that they do not pile up in long-lived threads. Blocks released while the thread is
+    /// exiting, once its free lists are gone (e.g. by a `thread_local` slice), go straight to the central free list.
+    ///
+    /// The pool must outlive all the slices allocated from it.
+    class BufferPool
+    {
+    public:
+        /// Default number of blocks allocated at once.
+        static constexpr std::size_t DefaultChunkSize{64};
+
+        // Not default-constructible.
+        BufferPool() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] block_size       Size of each block (rounded up to a multiple of the cache line size).
+        /// @param[in] chunk_size       Number of blocks allocated at once when the pool runs out of blocks. This is
+        ///                             also the maximum number of blocks kept in the free list of each thread.
+        explicit BufferPool(std::size_t block_size, std::size_t chunk_size = DefaultChunkSize)
+            : m_id{next_id()}
+            , m_block_size{round_up(block_size)}
+            , m_chunk_size{std::max<std::size_t>(chunk_size, 2)}
+            , m_mutex{}
+            , m_chunks{}
+            , m_free{nullptr}
+            , m_capacity{0}
+        {
+            std::lock_guard lock{registry_mutex()};
+
+            registry().emplace(m_id, this);
+        }
+
+        // Not copyable
+        BufferPool(const BufferPool&) = delete;
+        BufferPool& operator=(const BufferPool&) = delete;
+
+        // Not movable
+        BufferPool(BufferPool&&) = delete;
+        BufferPool& operator=(BufferPool&&) = delete;
+
+        virtual ~BufferPool()
+        {
+            {
+                std::lock_guard lock{registry_mutex()};
+
+                registry().erase(m_id);
+            }
+
+            if (!thread_exited())
+            {
+                auto& caches{thread_caches().caches};
+
+                std::erase_if(
+                    caches,
+                    [this](const ThreadCache& cache)
+                    {
+                        return cache.pool_id == m_id;
+                    });
+            }
+
+            for (auto* chunk : m_chunks)
+            {
+                ::operator delete(chunk, std::align_val_t{detail::CacheLineSize});
+            }
+        }
+
+        /// @brief Obtain the size of each block.
+        std::size_t block_size() const
+        {
+            return m_block_size;
+        }
+
+        /// @brief Obtain the total number of blocks allocated by the pool.
+        std::size_t capacity() const
+        {
+            std::lock_guard lock{m_mutex};
+
+            return m_capacity;
+        }
+
+        /// @brief Obtain the number of free lists held by the current thread, across all the pools.
+        static std::size_t thread_cache_count()
+        {
+            return thread_exited() ? 0 : thread_caches().caches.size();
+        }
+
+        /// @brief Allocate a block.
+        ///
+        /// @returns Slice spanning the whole block.
+        BufferSlice allocate()
+        {
+            if (thread_exited())
+            {
+                return allocate_shared();
+            }
+
+            auto& cache{thread_cache()};
+
+            if (!cache.head)
+            {
+                refill(cache);
+            }
+
+            auto* block{cache.head};
+
+            cache.head = block->next;
+            cache.count--;
+
+            block->next = nullptr;
+            block->refs.store(1, std::memory_order_relaxed);
+
+            return BufferSlice{block, 0, m_block_size};
+        }
+
+    private:
+        friend class BufferSlice;
+
+        /// @brief Free list of a pool local to a thread.
+        struct ThreadCache
+        {
+            std::uint64_t pool_id;
+            detail::BlockHeader* head;
+            std::size_t count;
+        };
+
+        /// @brief Obtain a unique identifier for a pool.
+        ///
+        /// @details
+        /// Identifiers are never reused, so that the free lists of destroyed pools are never mistaken for those of
+        /// new pools allocated at the same address.
+        static std::uint64_t next_id()
+        {
+            static std::atomic<std::uint64_t> counter{0};
+
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// @brief Round a size up to a multiple of the cache line size.
+        static std::size_t round_up(std::size_t size)
+        {
+            size = std::max<std::size_t>(size, 1);
+
+            return ((size + detail::CacheLineSize - 1) / detail::CacheLineSize) * detail::CacheLineSize;
+        }
+
+        /// @brief Free lists of a thread, which are returned to their pools when the thread exits.
+        struct ThreadCaches
+        {
+            std::vector<ThreadCache> caches;
+
+            ~ThreadCaches()
+            {
+                // Blocks released from now on (e.g. by other thread-local objects) bypass the free lists
+                thread_exited() = true;
+
+                std::lock_guard lock{registry_mutex()};
+
+                for (const auto& cache : caches)
+                {
+                    auto it{registry().find(cache.pool_id)};
+
+                    if (it != registry().end() && cache.head)
+                    {
+                        it->second->give_back(cache.head);
+                    }
+                }
+            }
+        };
+
+        /// @brief Obtain the mutex that protects the registry of live pools.
+        static std::mutex& registry_mutex()
+        {
+            static std::mutex mutex{};
+
+            return mutex;
+        }
+
+        /// @brief Obtain the registry of live pools, indexed by identifier.
+        static std::unordered_map<std::uint64_t, BufferPool*>& registry()
+        {
+            static std::unordered_map<std::uint64_t, BufferPool*> pools{};
+
+            return pools;
+        }
+
+        /// @brief Obtain whether the free lists of the current thread have been destroyed, as the thread is exiting.
+        ///
+        /// @note Trivially destructible, hence still usable while the other thread-local objects are destroyed.
+        static bool& thread_exited()
+        {
+            thread_local bool exited{false};
+
+            return exited;
+        }
+
+        /// @brief Obtain the free lists of the current thread.
+        ///
+        /// @warning Must not be used once the thread is exiting (see @ref thread_exited()).
+        static ThreadCaches& thread_caches()
+        {
+            thread_local ThreadCaches caches{};
+
+            return caches;
+        }
+
+        /// @brief Obtain the free list of this pool for the current thread.
+        ///
+        /// @details
+        /// When the list has to be created, those of the pools that were destroyed from other threads are discarded.
+        ThreadCache& thread_cache()
+        {
+            auto& caches{thread_caches().caches};
+
+            for (auto& cache : caches)
+            {
+                if (cache.pool_id == m_id)
+                {
+                    return cache;
+                }
+            }
+
+            {
+                std::lock_guard lock{registry_mutex()};
+
+                // Their blocks belonged to chunks that were already freed
+                std::erase_if(
+                    caches,
+                    [](const ThreadCache& cache)
+                    {
+                        return !registry().contains(cache.pool_id);
+                    });
+            }
+
+            return caches.emplace_back(m_id, nullptr, 0);
+        }
+
+        /// @brief Refill the free list of the current thread from the central free list.
+        ///
+        /// @details
+        /// A new chunk is allocated if the central free list is empty.
+        ///
+        /// @param[in] cache            Free list of the current thread.
+        void refill(ThreadCache& cache)
+        {
+            std::lock_guard lock{m_mutex};
+
+            if (!m_free)
+            {
+                allocate_chunk();
+            }
+
+            // Take up to half a chunk
+            while (m_free && cache.count < (m_chunk_size / 2))
+            {
+                auto* block{m_free};
+
+                m_free = block->next;
+                block->next = cache.head;
+                cache.head = block;
+                cache.count++;
+            }
+        }
+
+        /// @brief Allocate a block straight from the central free list, bypassing the free list of the thread.
+        ///
+        /// @returns Slice spanning the whole block.
+        BufferSlice allocate_shared()
+        {
+            detail::BlockHeader* block{nullptr};
+
+            {
+                std::lock_guard lock{m_mutex};
+
+                if (!m_free)
+                {
+                    allocate_chunk();
+                }
+
+                block = m_free;
+                m_free = block->next;
+            }
+
+            block->next = nullptr;
+            block->refs.store(1, std::memory_order_relaxed);
+
+            return BufferSlice{block, 0, m_block_size};
+        }
+
+        /// @brief Allocate a new chunk of blocks into the central free list.
+        ///
+        /// @pre The mutex is locked.
+        void allocate_chunk()
+        {
+            std::size_t stride{sizeof(detail::BlockHeader) + m_block_size};
+            auto* chunk{static_cast<std::uint8_t*>(
+                ::operator new(stride * m_chunk_size, std::align_val_t{detail::CacheLineSize}))};
+
+            m_chunks.push_back(chunk);
+
+            for (std::size_t i = 0; i < m_chunk_size; i++)
+            {
+                auto* block{new (chunk + (i * stride)) detail::BlockHeader{{0}, this, m_free}};
+
+                m_free = block;
+            }
+
+            m_capacity += m_chunk_size;
+        }
+
+        /// @brief Move a list of blocks to the central free list.
+        ///
+        /// @param[in] first            First block of the list.
+        void give_back(detail::BlockHeader* first)
+        {
+            auto* last{first};
+
+            while (last->next)
+            {
+                last = last->next;
+            }
+
+            std::lock_guard lock{m_mutex};
+
+            last->next = m_free;
+            m_free = first;
+        }
+
+        /// @brief Return an unused block to the free list of the current thread.
+        ///
+        /// @details
+        /// If the free list is full, half of it is moved to the central free list.
+        ///
+        /// @param[in] block            Block to return.
+        void release(detail::BlockHeader* block)
+        {
+            if (thread_exited())
+            {
+                block->next = nullptr;
+                give_back(block);
+                return;
+            }
+
+            auto& cache{thread_cache()};
+
+            block->next = cache.head;
+            cache.head = block;
+            cache.count++;
+
+            if (cache.count < m_chunk_size)
+            {
+                return;
+            }
+
+            // Detach half of the list
+            auto* first{cache.head};
+            auto* last{first};
+
+            for (std::size_t i = 1; i < (m_chunk_size / 2); i++)
+            {
+                last = last->next;
+            }
+
+            cache.head = last->next;
+            cache.count -= m_chunk_size / 2;
+            last->next = nullptr;
+
+            give_back(first);
+        }
+
+        std::uint64_t m_id;
+        std::size_t m_block_size;
+        std::size_t m_chunk_size;
+        mutable std::mutex m_mutex;
+        std::vector<std::uint8_t*> m_chunks;
+        detail::BlockHeader* m_free;
+        std::size_t m_capacity;
+    };
+
+    inline void BufferSlice::release()
+    {
+        if (m_block && m_block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            m_block->pool->release(m_block);
+        }
+
+        m_block = nullptr;
+        m_offset = 0;
+        m_size = 0;
+    }
+}  // namespace kouta::io
@@ -0,0 +1,660 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <kouta/io/checksum.hpp>
+#include <kouta/io/compression.hpp>
+#include <kouta/io/mapped-file.hpp>
+#include <kouta/io/packer.hpp>
+#include <kouta/io/parser.hpp>
+
+/// @brief Append-only capture files.
+///
+/// @details
+/// A capture file stores a sequence of timestamped blocks (e.g. the frames received from a device), so that they can
+/// be replayed later on. The file is laid out as follows (all the fields are big-endian):
+///
+/// - File header (8 bytes): magic (`KCAP`, 4 bytes), version (2 bytes) and reserved (2 bytes).
+/// - Blocks, each of them made of a header (24 bytes) followed by the payload:
+///   - Magic (`KBLK`, 4 bytes).
+///   - Timestamp (8 bytes), in an application-defined unit. Timestamps may not decrease along the file.
+///   - Length of the payload (4 bytes).
+///   - Flags (4 bytes). The upper 8 bits hold the @ref compression::Codec of the payload, the rest are available to
+///     the application.
+///   - CRC-32C of the previous header fields and the payload (4 bytes).
+/// - Sparse index, made of (timestamp, offset) entries of 16 bytes each, pointing to a subset of the blocks.
+/// - Trailer (20 bytes): offset of the index (8 bytes), number of entries (4 bytes), CRC-32C of the entries
+///   (4 bytes) and magic (`KIDX`, 4 bytes).
+///
+/// Compressed payloads are prefixed with their size before compression (4 bytes).
+///
+/// The index and trailer are written when the capture is finished. Files lacking them (e.g. because the application
+/// crashed) can still be read, in which case the index is rebuilt by scanning the blocks.
+namespace kouta::io::capture
+{
+    /// Magic value of the file header.
+    inline constexpr std::uint32_t FileMagic{0x4B434150};
+    /// Magic value of the block headers.
+    inline constexpr std::uint32_t BlockMagic{0x4B424C4B};
+    /// Magic value of the trailer.
+    inline constexpr std::uint32_t IndexMagic{0x4B494458};
+    /// Version of the format.
+    inline constexpr std::uint16_t Version{1};
+
+    /// Size of the file header.
+    inline constexpr std::size_t FileHeaderSize{8};
+    /// Size of the block headers.
+    inline constexpr std::size_t BlockHeaderSize{24};
+    /// Size of each index entry.
+    inline constexpr std::size_t IndexEntrySize{16};
+    /// Size of the trailer.
+    inline constexpr std::size_t TrailerSize{20};
+
+    /// Bits of the block flags that hold the compression codec.
+    inline constexpr std::uint32_t CodecMask{0xFF000000};
+    /// Position of the compression codec in the block flags.
+    inline constexpr unsigned CodecShift{24};
+
+    /// @brief Block read from a capture file.
+    struct Record
+    {
+        /// Timestamp of the block.
+        std::uint64_t timestamp;
+        /// Flags of the block.
+        std::uint32_t flags;
+        /// Parser over the payload of the block (backed by the mapped file).
+        Parser payload;
+    };
+
+    /// @brief Range of blocks in a capture file, given by their offsets.
+    struct Range
+    {
+        /// Offset of the first block.
+        std::size_t begin;
+        /// Offset past the last block.
+        std::size_t end;
+    };
+
+    /// @brief Entry of the sparse index.
+    struct IndexEntry
+    {
+        /// Timestamp of the block.
+        std::uint64_t timestamp;
+        /// Offset of the block.
+        std::size_t offset;
+    };
+
+    /// @brief Capture file writer.
+    ///
+    /// @details
+    /// Blocks are appended through a @ref MappedPacker. An index entry is recorded for the first block written after
+    /// every @p index_interval bytes, so that the size of the index stays small regardless of the number of blocks.
+    ///
+    /// Payloads may be compressed, in which case each of them is compressed independently (hence blocks should hold
+    /// several frames for the compression to be effective). Payloads that do not shrink are stored uncompressed.
+    class Writer
+    {
+    public:
+        /// Default number of bytes between index entries.
+        static constexpr std::size_t DefaultIndexInterval{64 * 1024};
+
+        // Not default-constructible.
+        Writer() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @details
+        /// The file is created, or truncated if it already exists.
+        ///
+        /// @param[in] path             Path of the file to write.
+        /// @param[in] index_interval   Minimum number of bytes between index entries.
+        /// @param[in] codec            Codec used to compress the payloads.
+        /// @param[in] level            Codec-specific compression level (see @ref compression::Compressor).
+        ///
+        /// @throws std::system_error if the file cannot be created.
+        /// @throws std::invalid_argument if the codec was not enabled at build time.
+        explicit Writer(const std::filesystem::path& path,
+                        std::size_t index_interval = DefaultIndexInterval,
+                        compression::Codec codec = compression::Codec::None,
+                        int level = 0)
+            : m_packer{path}
+            , m_compressor{codec, level}
+            , m_header{BlockHeaderSize + 4}
+            , m_index{}
+            , m_index_interval{std::max<std::size_t>(index_interval, 1)}
+            , m_last_timestamp{0}
+            , m_blocks{0}
+            , m_finished{false}
+        {
+            m_packer.insert_integral<std::uint32_t>(FileMagic);
+            m_packer.insert_integral<std::uint16_t>(Version);
+            m_packer.insert_integral<std::uint16_t>(0);
+        }
+
+        // Not copyable
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        // Not movable
+        Writer(Writer&&) = delete;
+        Writer& operator=(Writer&&) = delete;
+
+        virtual ~Writer()
+        {
+            try
+            {
+                finish();
+            }
+            catch (...)
+            {
+                // Nothing to do at this point
+            }
+        }
+
+        /// @brief Obtain the number of bytes written.
+        std::size_t size() const
+        {
+            return m_packer.size();
+        }
+
+        /// @brief Obtain the number of blocks written.
+        std::size_t blocks() const
+        {
+            return m_blocks;
+        }
+
+        /// @brief Append a block to the file.
+        ///
+        /// @param[in] timestamp        Timestamp of the block.
+        /// @param[in] payload          Payload of the block.
+        /// @param[in] flags            Flags of the block.
+        ///
+        /// @returns Offset of the block in the file.
+        ///
+        /// @throws std::invalid_argument if @p timestamp is lower than the timestamp of the previous block, or
+        ///         @p flags uses the bits reserved for the codec (see @ref CodecMask).
+        /// @throws std::length_error if the payload does not fit in a block.
+        /// @throws std::logic_error if the capture was already finished.
+        std::size_t append(std::uint64_t timestamp, std::span<const std::uint8_t> payload, std::uint32_t flags = 0)
+        {
+            if (m_finished)
+            {
+                throw std::logic_error("capture already finished");
+            }
+
+            if (m_blocks > 0 && timestamp < m_last_timestamp)
+            {
+                throw std::invalid_argument("timestamps may not decrease");
+            }
+
+            if ((flags & CodecMask) != 0)
+            {
+                throw std::invalid_argument("flags use reserved bits");
+            }
+
+            // Keep the compressed payload only if it is smaller, including its size prefix
+            auto stored{payload};
+            std::size_t prefix{0};
+
+            if (m_compressor.codec() != compression::Codec::None)
+            {
+                auto compressed{m_compressor.compress(payload)};
+
+                if ((compressed.size() + 4) < payload.size())
+                {
+                    stored = compressed;
+                    prefix = 4;
+                    flags |= static_cast<std::uint32_t>(m_compressor.codec()) << CodecShift;
+                }
+            }
+
+            if ((prefix + stored.size()) > std::numeric_limits<std::uint32_t>::max())
+            {
+                throw std::length_error("payload too large");
+            }
+
+            std::size_t offset{m_packer.size()};
+
+            if (m_index.empty() || (offset - m_index.back().offset) >= m_index_interval)
+            {
+                m_index.push_back(IndexEntry{timestamp, offset});
+            }
+
+            // The header is reused between blocks to avoid allocating memory
+            m_header.data().clear();
+            m_header.insert_integral<std::uint32_t>(BlockMagic);
+            m_header.insert_integral<std::uint64_t>(timestamp);
+            m_header.insert_integral<std::uint32_t>(static_cast<std::uint32_t>(prefix + stored.size()));
+            m_header.insert_integral<std::uint32_t>(flags);
+
+            auto placeholder{m_header.reserve<std::uint32_t>()};
+
+            if (prefix > 0)
+            {
+                m_header.insert_integral<std::uint32_t>(static_cast<std::uint32_t>(payload.size()));
+            }
+
+            // The checksum covers the header fields, the size prefix (if any) and the stored payload
+            std::span<const std::uint8_t> header{m_header.data()};
+            auto crc{checksum::Crc32c::compute(header.first(placeholder.offset()))};
+
+            crc = checksum::Crc32c::compute(header.subspan(BlockHeaderSize), crc);
+            m_header.patch(placeholder, checksum::Crc32c::compute(stored, crc));
+
+            m_packer.insert_bytes(m_header.data());
+            m_packer.insert_bytes(stored);
+
+            m_last_timestamp = timestamp;
+            m_blocks++;
+
+            return offset;
+        }
+
+        /// @brief Write the index and trailer, and close the file.
+        ///
+        /// @note No more blocks may be appended afterwards.
+        ///
+        /// @throws std::system_error if the file cannot be written.
+        void finish()
+        {
+            if (m_finished)
+            {
+                return;
+            }
+
+            m_finished = true;
+
+            std::size_t index_offset{m_packer.size()};
+            Packer index{m_index.size() * IndexEntrySize};
+
+            for (const auto& entry : m_index)
+            {
+                index.insert_integral<std::uint64_t>(entry.timestamp);
+                index.insert_integral<std::uint64_t>(entry.offset);
+            }
+
+            m_packer.insert_bytes(index.data());
+            m_packer.insert_integral<std::uint64_t>(index_offset);
+            m_packer.insert_integral<std::uint32_t>(static_cast<std::uint32_t>(m_index.size()));
+            m_packer.insert_integral<std::uint32_t>(checksum::Crc32c::compute(index.data()));
+            m_packer.insert_integral<std::uint32_t>(IndexMagic);
+            m_packer.finish();
+        }
+
+    private:
+        MappedPacker m_packer;
+        compression::Compressor m_compressor;
+        Packer m_header;
+        std::vector<IndexEntry> m_index;
+        std::size_t m_index_interval;
+        std::uint64_t m_last_timestamp;
+        std::size_t m_blocks;
+        bool m_finished;
+    };
+
+    /// @brief Capture file reader.
+    ///
+    /// @details
+    /// The file is memory-mapped, so that payloads are exposed as @ref Parser views without copying them. Seeking by
+    /// timestamp performs a binary search over the sparse index, followed by a short scan of block headers. The file
+    /// can also be split in several ranges of roughly the same size, so that each of them is replayed by a different
+    /// thread.
+    ///
+    /// @note The reader is not modified after construction, hence it can be shared between threads.
+    class Reader
+    {
+    public:
+        // Not default-constructible.
+        Reader() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] path             Path of the file to read.
+        ///
+        /// @throws std::system_error if the file cannot be opened or mapped.
+        /// @throws std::runtime_error if the file is not a capture file.
+        explicit Reader(const std::filesystem::path& path)
+            : m_file{path}
+            , m_range{FileHeaderSize, FileHeaderSize}
+            , m_index{}
+            , m_indexed{false}
+        {
+            if (m_file.size() < FileHeaderSize)
+            {
+                throw std::runtime_error("not a capture file");
+            }
+
+            auto parser{m_file.parser()};
+
+            if (parser.extract_integral<std::uint32_t>(0) != FileMagic)
+            {
+                throw std::runtime_error("not a capture file");
+            }
+
+            if (parser.extract_integral<std::uint16_t>(4) != Version)
+            {
+                throw std::runtime_error("unsupported capture version");
+            }
+
+            if (!load_index())
+            {
+                rebuild_index();
+            }
+        }
+
+        // Not copyable
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        // Movable
+        Reader(Reader&&) = default;
+        Reader& operator=(Reader&&) = default;
+
+        virtual ~Reader() = default;
+
+        /// @brief Obtain the underlying mapped file.
+        const MappedFile& file() const
+        {
+            return m_file;
+        }
+
+        /// @brief Obtain the range covering all the blocks.
+        Range range() const
+        {
+            return m_range;
+        }
+
+        /// @brief Check whether the index was read from the file (as opposed to rebuilt by scanning it).
+        bool indexed() const
+        {
+            return m_indexed;
+        }
+
+        /// @brief Obtain the sparse index.
+        std::span<const IndexEntry> index() const
+        {
+            return m_index;
+        }
+
+        /// @brief Find the first block whose timestamp is not lower than the given one.
+        ///
+        /// @param[in] timestamp        Timestamp to look for.
+        ///
+        /// @returns Offset of the block, or the end of @ref range() if there is no such block.
+        std::size_t seek(std::uint64_t timestamp) const
+        {
+            // The block lies after the last entry with a lower timestamp (entries with the same timestamp may be
+            // preceded by other blocks with said timestamp)
+            auto it{std::ranges::lower_bound(m_index, timestamp, {}, &IndexEntry::timestamp)};
+            std::size_t offset{it == m_index.begin() ? m_range.begin : std::prev(it)->offset};
+
+            while (offset < m_range.end)
+            {
+                auto [block_timestamp, length] = header(offset);
+
+                if (block_timestamp >= timestamp)
+                {
+                    break;
+                }
+
+                offset += BlockHeaderSize + length;
+            }
+
+            return offset;
+        }
+
+        /// @brief Split the blocks in several ranges of roughly the same size.
+        ///
+        /// @details
+        /// Ranges are delimited by index entries, hence fewer ranges than requested may be returned for small files.
+        ///
+        /// @param[in] count            Number of ranges to obtain.
+        ///
+        /// @returns Consecutive, non-empty ranges covering all the blocks.
+        std::vector<Range> split(std::size_t count) const
+        {
+            std::vector<Range> ranges{};
+            std::size_t total{m_range.end - m_range.begin};
+            std::size_t begin{m_range.begin};
+
+            for (std::size_t i = 1; i < count && begin < m_range.end; i++)
+            {
+                std::size_t target{m_range.begin + (total / count) * i};
+                auto it{std::ranges::lower_bound(m_index, target, {}, &IndexEntry::offset)};
+
+                if (it == m_index.end())
+                {
+                    break;
+                }
+
+                if (it->offset > begin)
+                {
+                    ranges.push_back(Range{begin, it->offset});
+                    begin = it->offset;
+                }
+            }
+
+            if (begin < m_range.end)
+            {
+                ranges.push_back(Range{begin, m_range.end});
+            }
+
+            return ranges;
+        }
+
+        /// @brief Read the block at the given offset, as stored in the file.
+        ///
+        /// @note Compressed payloads are not decompressed (the codec is given by the flags of the block).
+        ///
+        /// @param[in,out] offset       Offset of the block, updated to point to the next block.
+        ///
+        /// @returns Block read, or `std::nullopt` if @p offset is at the end of @ref range().
+        ///
+        /// @throws std::runtime_error if the block is corrupted.
+        std::optional<Record> read(std::size_t& offset) const
+        {
+            if (offset >= m_range.end)
+            {
+                return std::nullopt;
+            }
+
+            auto [timestamp, length] = header(offset);
+            auto parser{m_file.parser(offset, BlockHeaderSize + length)};
+            auto fields{parser.extract_bytes(0, BlockHeaderSize - checksum::Crc32c::Size)};
+            auto payload{parser.extract_bytes(BlockHeaderSize, length)};
+            auto crc{checksum::Crc32c::compute(payload, checksum::Crc32c::compute(fields))};
+
+            if (crc != parser.extract_integral<std::uint32_t>(fields.size()))
+            {
+                throw std::runtime_error("corrupted capture block");
+            }
+
+            offset += BlockHeaderSize + length;
+
+            return Record{timestamp, parser.extract_integral<std::uint32_t>(16), Parser{payload}};
+        }
+
+        /// @brief Read the block at the given offset, decompressing its payload if required.
+        ///
+        /// @param[in,out] offset       Offset of the block, updated to point to the next block.
+        /// @param[in] decompressor     Decompressor to use, which holds the payload until its next use.
+        ///
+        /// @returns Block read (without the codec bits in its flags), or `std::nullopt` if @p offset is at the end of
+        ///          @ref range().
+        ///
+        /// @throws std::runtime_error if the block is corrupted.
+        /// @throws std::invalid_argument if the codec of the block was not enabled at build time.
+        std::optional<Record> read(std::size_t& offset, compression::Decompressor& decompressor) const
+        {
+            auto record{read(offset)};
+
+            if (!record || (record->flags & CodecMask) == 0)
+            {
+                return record;
+            }
+
+            if (record->payload.size() < 4)
+            {
+                throw std::runtime_error("corrupted capture block");
+            }
+
+            auto codec{static_cast<compression::Codec>(record->flags >> CodecShift)};
+            auto size{record->payload.extract_integral<std::uint32_t>(0)};
+            auto compressed{record->payload.extract_bytes(4, record->payload.size() - 4)};
+
+            record->flags &= ~CodecMask;
+            record->payload = decompressor.decompress(codec, compressed, size);
+
+            return record;
+        }
+
+        /// @brief Read all the blocks in a range.
+        ///
+        /// @param[in] range            Range of blocks to read.
+        /// @param[in] function         Function to invoke for each block (with its payload decompressed), taking a
+        ///                             `const Record&`.
+        ///
+        /// @throws std::runtime_error if a block is corrupted.
+        template<class TFunction>
+        void replay(const Range& range, TFunction&& function) const
+        {
+            compression::Decompressor decompressor{};
+            std::size_t offset{range.begin};
+
+            while (offset < range.end)
+            {
+                function(*read(offset, decompressor));
+            }
+        }
+
+    private:
+        /// @brief Parse the timestamp and length of the block at the given offset.
+        ///
+        /// @throws std::runtime_error if there is no valid block header at said offset.
+        std::pair<std::uint64_t, std::uint32_t> header(std::size_t offset) const
+        {
+            if (offset + BlockHeaderSize > m_file.size())
+            {
+                throw std::runtime_error("truncated capture block");
+            }
+
+            auto parser{m_file.parser(offset, BlockHeaderSize)};
+
+            if (parser.extract_integral<std::uint32_t>(0) != BlockMagic)
+            {
+                throw std::runtime_error("corrupted capture block");
+            }
+
+            auto length{parser.extract_integral<std::uint32_t>(12)};
+
+            if (offset + BlockHeaderSize + length > m_file.size())
+            {
+                throw std::runtime_error("truncated capture block");
+            }
+
+            return {parser.extract_integral<std::uint64_t>(4), length};
+        }
+
+        /// @brief Load the index from the trailer of the file.
+        ///
+        /// @returns Whether a valid index was found.
+        bool load_index()
+        {
+            if (m_file.size() < FileHeaderSize + TrailerSize)
+            {
+                return false;
+            }
+
+            auto trailer{m_file.parser(m_file.size() - TrailerSize, TrailerSize)};
+
+            if (trailer.extract_integral<std::uint32_t>(16) != IndexMagic)
+            {
+                return false;
+            }
+
+            auto index_offset{trailer.extract_integral<std::uint64_t>(0)};
+            std::size_t count{trailer.extract_integral<std::uint32_t>(8)};
+
+            if (index_offset < FileHeaderSize || (index_offset + count * IndexEntrySize + TrailerSize) != m_file.size())
+            {
+                return false;
+            }
+
+            auto entries{m_file.parser(index_offset, count * IndexEntrySize)};
+
+            if (checksum::Crc32c::compute(m_file.view().subspan(index_offset, count * IndexEntrySize)) !=
+                trailer.extract_integral<std::uint32_t>(12))
+            {
+                return false;
+            }
+
+            m_index.reserve(count);
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                m_index.push_back(IndexEntry{entries.extract_integral<std::uint64_t>(i * IndexEntrySize),
+                                             entries.extract_integral<std::uint64_t>(i * IndexEntrySize + 8)});
+            }
+
+            m_range.end = index_offset;
+            m_indexed = true;
+
+            return true;
+        }
+
+        /// @brief Rebuild the index by scanning the blocks.
+        ///
+        /// @details
+        /// The scan stops at the first invalid block (e.g. the unused space left by an unfinished capture).
+        void rebuild_index()
+        {
+            std::size_t offset{m_range.begin};
+            std::uint64_t last_timestamp{0};
+
+            while (offset < m_file.size())
+            {
+                std::size_t next{offset};
+
+                try
+                {
+                    auto [timestamp, length] = header(offset);
+
+                    if (timestamp < last_timestamp)
+                    {
+                        break;
+                    }
+
+                    if (m_index.empty() || (offset - m_index.back().offset) >= Writer::DefaultIndexInterval)
+                    {
+                        m_index.push_back(IndexEntry{timestamp, offset});
+                    }
+
+                    last_timestamp = timestamp;
+                    next += BlockHeaderSize + length;
+                }
+                catch (const std::runtime_error&)
+                {
+                    break;
+                }
+
+                offset = next;
+            }
+
+            m_range.end = offset;
+        }
+
+        MappedFile m_file;
+        Range m_range;
+        std::vector<IndexEntry> m_index;
+        bool m_indexed;
+    };
+}  // namespace kouta::io::capture
@@ -0,0 +1,495 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+#include <boost/endian.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define KOUTA_IO_CHECKSUM_X86
+#include <immintrin.h>
+#endif
+
+namespace kouta::io::checksum
+{
+    /// @brief Checksum algorithm.
+    ///
+    /// @details
+    /// An algorithm exposes the type of its value, the number of bytes it occupies when serialized, and a static
+    /// `compute()` method that computes the checksum of a byte sequence. This method accepts the result of a previous
+    /// computation, so that checksums can be computed over non-contiguous sequences.
+    template<class T>
+    concept Algorithm = requires(std::span<const std::uint8_t> view, typename T::Value value) {
+        requires std::unsigned_integral<typename T::Value>;
+        { T::Size } -> std::convertible_to<std::size_t>;
+        { T::compute(view) } -> std::same_as<typename T::Value>;
+        { T::compute(view, value) } -> std::same_as<typename T::Value>;
+    };
+
+    namespace detail
+    {
+        /// Signature of the implementations of the CRC32 variants, which operate on the raw (non-inverted) state.
+        using Crc32Function = std::uint32_t (*)(std::uint32_t, const std::uint8_t*, std::size_t);
+
+        /// @brief Generate slicing-by-8 tables for a reflected 32-bit CRC.
+        ///
+        /// @details
+        /// `table[k][b]` holds the CRC of byte `b` followed by `k` zero bytes.
+        ///
+        /// @param[in] polynomial       Reflected polynomial.
+        consteval std::array<std::array<std::uint32_t, 256>, 8> make_crc32_tables(std::uint32_t polynomial)
+        {
+            std::array<std::array<std::uint32_t, 256>, 8> tables{};
+
+            for (std::uint32_t i = 0; i < 256; i++)
+            {
+                std::uint32_t crc{i};
+
+                for (int bit = 0; bit < 8; bit++)
+                {
+                    crc = (crc & 1) ? ((crc >> 1) ^ polynomial) : (crc >> 1);
+                }
+
+                tables[0][i] = crc;
+            }
+
+            for (std::size_t k = 1; k < 8; k++)
+            {
+                for (std::size_t i = 0; i < 256; i++)
+                {
+                    tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+                }
+            }
+
+            return tables;
+        }
+
+        /// @brief Generate slicing-by-8 tables for a non-reflected 16-bit CRC.
+        ///
+        /// @details
+        /// `table[k][b]` holds the CRC of byte `b` followed by `k` zero bytes.
+        ///
+        /// @param[in] polynomial       Polynomial.
+        consteval std::array<std::array<std::uint16_t, 256>, 8> make_crc16_tables(std::uint16_t polynomial)
+        {
+            std::array<std::array<std::uint16_t, 256>, 8> tables{};
+
+            for (std::uint32_t i = 0; i < 256; i++)
+            {
+                std::uint16_t crc{static_cast<std::uint16_t>(i << 8)};
+
+                for (int bit = 0; bit < 8; bit++)
+                {
+                    crc = static_cast<std::uint16_t>((crc & 0x8000) ? ((crc << 1) ^ polynomial) : (crc << 1));
+                }
+
+                tables[0][i] = crc;
+            }
+
+            for (std::size_t k = 1; k < 8; k++)
+            {
+                for (std::size_t i = 0; i < 256; i++)
+                {
+                    tables[k][i] =
+                        static_cast<std::uint16_t>((tables[k - 1][i] << 8) ^ tables[0][tables[k - 1][i] >> 8]);
+                }
+            }
+
+            return tables;
+        }
+
+        /// Slicing-by-8 tables for CRC32 (IEEE 802.3).
+        inline constexpr auto Crc32Tables{make_crc32_tables(0xEDB88320)};
+
+        /// Slicing-by-8 tables for CRC32C (Castagnoli).
+        inline constexpr auto Crc32cTables{make_crc32_tables(0x82F63B78)};
+
+        /// Slicing-by-8 tables for CRC16 (CCITT).
+        inline constexpr auto Crc16Tables{make_crc16_tables(0x1021)};
+
+        /// @brief Update a reflected 32-bit CRC with slicing-by-8 tables.
+        ///
+        /// @param[in] tables           Slicing-by-8 tables of the CRC.
+        /// @param[in] crc              Current (non-inverted) state.
+        /// @param[in] data             Data to process.
+        /// @param[in] count            Number of bytes to process.
+        ///
+        /// @returns Updated (non-inverted) state.
+        inline std::uint32_t crc32_slicing(
+            const std::array<std::array<std::uint32_t, 256>, 8>& tables,
+            std::uint32_t crc,
+            const std::uint8_t* data,
+            std::size_t count)
+        {
+            while (count >= 8)
+            {
+                std::uint32_t low{boost::endian::load_little_u32(data) ^ crc};
+                std::uint32_t high{boost::endian::load_little_u32(data + 4)};
+
+                crc = tables[7][low & 0xFF] ^ tables[6][(low >> 8) & 0xFF] ^ tables[5][(low >> 16) & 0xFF]
+                      ^ tables[4][low >> 24] ^ tables[3][high & 0xFF] ^ tables[2][(high >> 8) & 0xFF]
+                      ^ tables[1][(high >> 16) & 0xFF] ^ tables[0][high >> 24];
+
+                data += 8;
+                count -= 8;
+            }
+
+            while (count-- > 0)
+            {
+                crc = (crc >> 8) ^ tables[0][(crc ^ *data++) & 0xFF];
+            }
+
+            return crc;
+        }
+
+        /// @brief Portable CRC32 implementation.
+        inline std::uint32_t crc32_portable(std::uint32_t crc, const std::uint8_t* data, std::size_t count)
+        {
+            return crc32_slicing(Crc32Tables, crc, data, count);
+        }
+
+        /// @brief Portable CRC32C implementation.
+        inline std::uint32_t crc32c_portable(std::uint32_t crc, const std::uint8_t* data, std::size_t count)
+        {
+            return crc32_slicing(Crc32cTables, crc, data, count);
+        }
+
+#ifdef KOUTA_IO_CHECKSUM_X86
+        /// @brief CRC32C implementation based on the SSE4.2 `crc32` instruction.
+        __attribute__((target("sse4.2"))) inline std::uint32_t crc32c_sse42(
+            std::uint32_t crc,
+            const std::uint8_t* data,
+            std::size_t count)
+        {
+#ifdef __x86_64__
+            std::uint64_t crc64{crc};
+
+            while (count >= 8)
+            {
+                crc64 = _mm_crc32_u64(crc64, boost::endian::load_little_u64(data));
+                data += 8;
+                count -= 8;
+            }
+
+            crc = static_cast<std::uint32_t>(crc64);
+#endif
+
+            while (count >= 4)
+            {
+                crc = _mm_crc32_u32(crc, boost::endian::load_little_u32(data));
+                data += 4;
+                count -= 4;
+            }
+
+            while (count-- > 0)
+            {
+                crc = _mm_crc32_u8(crc, *data++);
+            }
+
+            return crc;
+        }
+
+        /// @brief Load 16 unaligned bytes.
+        __attribute__((target("sse4.2,pclmul"))) inline __m128i load_128(const std::uint8_t* data)
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        }
+
+        /// @brief Fold 128 bits of state with the constants @p k onto the @p next 128 bits.
+        __attribute__((target("sse4.2,pclmul"))) inline __m128i fold_128(__m128i x, __m128i k, __m128i next)
+        {
+            __m128i low{_mm_clmulepi64_si128(x, k, 0x00)};
+            __m128i high{_mm_clmulepi64_si128(x, k, 0x11)};
+
+            return _mm_xor_si128(_mm_xor_si128(high, low), next);
+        }
+
+        /// @brief CRC32 implementation based on carry-less multiplication (PCLMULQDQ) folding.
+        ///
+        /// @details
+        /// Folds 64-byte blocks in parallel, then reduces them with Barrett reduction as described in Intel's "Fast
+        /// CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction". The remaining bytes (less than 16)
+        /// are processed with the slicing-by-8 tables.
+        ///
+        /// @pre @p count is at least 64.
+        __attribute__((target("sse4.2,pclmul"))) inline std::uint32_t crc32_pclmul(
+            std::uint32_t crc,
+            const std::uint8_t* data,
+            std::size_t count)
+        {
+            // Folding constants for the reflected polynomial
+            const __m128i k1k2{_mm_set_epi64x(0x01c6e41596, 0x0154442bd4)};
+            const __m128i k3k4{_mm_set_epi64x(0x00ccaa009e, 0x01751997d0)};
+            const __m128i k5k0{_mm_set_epi64x(0x0000000000, 0x0163cd6124)};
+            const __m128i poly{_mm_set_epi64x(0x01f7011641, 0x01db710641)};
+            const __m128i mask32{_mm_setr_epi32(~0, 0, ~0, 0)};
+
+            __m128i x1{_mm_xor_si128(load_128(data), _mm_cvtsi32_si128(static_cast<int>(crc)))};
+            __m128i x2{load_128(data + 16)};
+            __m128i x3{load_128(data + 32)};
+            __m128i x4{load_128(data + 48)};
+
+            data += 64;
+            count -= 64;
+
+            // Fold 64-byte blocks in parallel
+            while (count >= 64)
+            {
+                x1 = fold_128(x1, k1k2, load_128(data));
+                x2 = fold_128(x2, k1k2, load_128(data + 16));
+                x3 = fold_128(x3, k1k2, load_128(data + 32));
+                x4 = fold_128(x4, k1k2, load_128(data + 48));
+
+                data += 64;
+                count -= 64;
+            }
+
+            // Fold into 128 bits
+            x1 = fold_128(x1, k3k4, x2);
+            x1 = fold_128(x1, k3k4, x3);
+            x1 = fold_128(x1, k3k4, x4);
+
+            // Fold 16-byte blocks
+            while (count >= 16)
+            {
+                x1 = fold_128(x1, k3k4, load_128(data));
+
+                data += 16;
+                count -= 16;
+            }
+
+            // Fold 128 bits into 64 bits
+            __m128i x2r{_mm_clmulepi64_si128(x1, k3k4, 0x10)};
+            x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2r);
+
+            x2r = _mm_srli_si128(x1, 4);
+            x1 = _mm_and_si128(x1, mask32);
+            x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+            x1 = _mm_xor_si128(x1, x2r);
+
+            // Barrett reduction to 32 bits
+            x2r = _mm_and_si128(x1, mask32);
+            x2r = _mm_clmulepi64_si128(x2r, poly, 0x10);
+            x2r = _mm_and_si128(x2r, mask32);
+            x2r = _mm_clmulepi64_si128(x2r, poly, 0x00);
+            x1 = _mm_xor_si128(x1, x2r);
+
+            crc = static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+
+            return crc32_portable(crc, data, count);
+        }
+
+        /// @brief CRC32 implementation that uses PCLMULQDQ folding for large enough inputs.
+        inline std::uint32_t crc32_accelerated(std::uint32_t crc, const std::uint8_t* data, std::size_t count)
+        {
+            if (count < 64)
+            {
+                return crc32_portable(crc, data, count);
+            }
+
+            return crc32_pclmul(crc, data, count);
+        }
+#endif
+
+        /// @brief Select the fastest CRC32 implementation supported by the CPU.
+        inline Crc32Function select_crc32()
+        {
+#ifdef KOUTA_IO_CHECKSUM_X86
+            if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.2"))
+            {
+                return &crc32_accelerated;
+            }
+#endif
+
+            return &crc32_portable;
+        }
+
+        /// @brief Select the fastest CRC32C implementation supported by the CPU.
+        inline Crc32Function select_crc32c()
+        {
+#ifdef KOUTA_IO_CHECKSUM_X86
+            if (__builtin_cpu_supports("sse4.2"))
+            {
+                return &crc32c_sse42;
+            }
+#endif
+
+            return &crc32c_portable;
+        }
+    }  // namespace detail
+
+    /// @brief CRC-32 (IEEE 802.3, as used by Ethernet, zlib or PNG).
+    ///
+    /// @details
+    /// Uses PCLMULQDQ folding when supported by the CPU (detected at runtime), or slicing-by-8 tables otherwise.
+    struct Crc32
+    {
+        /// Type of the checksum.
+        using Value = std::uint32_t;
+
+        /// Number of bytes the checksum occupies.
+        static constexpr std::size_t Size{4};
+
+        /// @brief Compute the checksum of a byte sequence.
+        ///
+        /// @param[in] view         Byte sequence.
+        /// @param[in] previous     Checksum of the preceding bytes, if any.
+        ///
+        /// @returns Checksum.
+        static Value compute(std::span<const std::uint8_t> view, Value previous = 0)
+        {
+            static const detail::Crc32Function impl{detail::select_crc32()};
+
+            return ~impl(~previous, view.data(), view.size());
+        }
+
+        /// @brief Compute the checksum of a byte sequence.
+        Value operator()(std::span<const std::uint8_t> view) const
+        {
+            return compute(view);
+        }
+    };
+
+    /// @brief CRC-32C (Castagnoli, as used by iSCSI, SCTP or ext4).
+    ///
+    /// @details
+    /// Uses the SSE4.2 `crc32` instruction when supported by the CPU (detected at runtime), or slicing-by-8 tables
+    /// otherwise.
+    struct Crc32c
+    {
+        /// Type of the checksum.
+        using Value = std::uint32_t;
+
+        /// Number of bytes the checksum occupies.
+        static constexpr std::size_t Size{4};
+
+        /// @brief Compute the checksum of a byte sequence.
+        ///
+        /// @param[in] view         Byte sequence.
+        /// @param[in] previous     Checksum of the preceding bytes, if any.
+        ///
+        /// @returns Checksum.
+        static Value compute(std::span<const std::uint8_t> view, Value previous = 0)
+        {
+            static const detail::Crc32Function impl{detail::select_crc32c()};
+
+            return ~impl(~previous, view.data(), view.size());
+        }
+
+        /// @brief Compute the checksum of a byte sequence.
+        Value operator()(std::span<const std::uint8_t> view) const
+        {
+            return compute(view);
+        }
+    };
+
+    /// @brief CRC-16/CCITT-FALSE (polynomial `0x1021`, initial value `0xFFFF`, not reflected).
+    ///
+    /// @details
+    /// Uses slicing-by-8 tables.
+    struct Crc16
+    {
+        /// Type of the checksum.
+        using Value = std::uint16_t;
+
+        /// Number of bytes the checksum occupies.
+        static constexpr std::size_t Size{2};
+
+        /// @brief Compute the checksum of a byte sequence.
+        ///
+        /// @param[in] view         Byte sequence.
+        /// @param[in] previous     Checksum of the preceding bytes, if any.
+        ///
+        /// @returns Checksum.
+        static Value compute(std::span<const std::uint8_t> view, Value previous = 0xFFFF)
+        {
+            const auto& tables{detail::Crc16Tables};
+            const std::uint8_t* data{view.data()};
+            std::size_t count{view.size()};
+            std::uint16_t crc{previous};
+
+            while (count >= 8)
+            {
+                crc = tables[7][data[0] ^ (crc >> 8)] ^ tables[6][data[1] ^ (crc & 0xFF)] ^ tables[5][data[2]]
+                      ^ tables[4][data[3]] ^ tables[3][data[4]] ^ tables[2][data[5]] ^ tables[1][data[6]]
+                      ^ tables[0][data[7]];
+
+                data += 8;
+                count -= 8;
+            }
+
+            while (count-- > 0)
+            {
+                crc = static_cast<std::uint16_t>((crc << 8) ^ tables[0][(crc >> 8) ^ *data++]);
+            }
+
+            return crc;
+        }
+
+        /// @brief Compute the checksum of a byte sequence.
+        Value operator()(std::span<const std::uint8_t> view) const
+        {
+            return compute(view);
+        }
+    };
+
+    /// @brief Adler-32 (as used by zlib).
+    ///
+    /// @details
+    /// Defers the modulo operations for as long as the sums cannot overflow, which allows the compiler to unroll and
+    /// vectorize the inner loop.
+    struct Adler32
+    {
+        /// Type of the checksum.
+        using Value = std::uint32_t;
+
+        /// Number of bytes the checksum occupies.
+        static constexpr std::size_t Size{4};
+
+        /// @brief Compute the checksum of a byte sequence.
+        ///
+        /// @param[in] view         Byte sequence.
+        /// @param[in] previous     Checksum of the preceding bytes, if any.
+        ///
+        /// @returns Checksum.
+        static Value compute(std::span<const std::uint8_t> view, Value previous = 1)
+        {
+            // Largest prime below 2^16
+            constexpr std::uint32_t Modulo{65521};
+            // Largest number of bytes that can be processed before the sums overflow
+            constexpr std::size_t MaxBlock{5552};
+
+            std::uint32_t a{previous & 0xFFFF};
+            std::uint32_t b{previous >> 16};
+            const std::uint8_t* data{view.data()};
+            std::size_t count{view.size()};
+
+            while (count > 0)
+            {
+                std::size_t block{count < MaxBlock ? count : MaxBlock};
+
+                count -= block;
+
+                for (std::size_t i = 0; i < block; i++)
+                {
+                    a += data[i];
+                    b += a;
+                }
+
+                data += block;
+                a %= Modulo;
+                b %= Modulo;
+            }
+
+            return (b << 16) | a;
+        }
+
+        /// @brief Compute the checksum of a byte sequence.
+        Value operator()(std::span<const std::uint8_t> view) const
+        {
+            return compute(view);
+        }
+    };
+}  // namespace kouta::io::checksum
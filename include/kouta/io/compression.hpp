@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <kouta/io/config.hpp>
+#include <kouta/io/parser.hpp>
+
+#ifdef KOUTA_USE_LZ4
+#include <lz4.h>
+#endif
+
+#ifdef KOUTA_USE_ZSTD
+#include <zstd.h>
+#endif
+
+/// @brief Block compression.
+///
+/// @details
+/// Compression operates on whole blocks (e.g. a batch of frames generated by a @ref Packer), which yields much
+/// better ratios than compressing small frames individually. Blocks are compressed independently from each other,
+/// so that they can be decompressed in any order (e.g. after seeking in a capture file).
+///
+/// The codecs are optional, and enabled at build time through the `KOUTA_USE_LZ4` and `KOUTA_USE_ZSTD` options.
+namespace kouta::io::compression
+{
+    /// @brief Compression codec.
+    enum class Codec : std::uint8_t
+    {
+        /// No compression.
+        None = 0,
+        /// LZ4 (fast, moderate ratio).
+        Lz4 = 1,
+        /// Zstandard (slower, high ratio).
+        Zstd = 2,
+    };
+
+    /// @brief Check whether a codec was enabled at build time.
+    constexpr bool available(Codec codec)
+    {
+        switch (codec)
+        {
+            case Codec::None:
+                return true;
+#ifdef KOUTA_USE_LZ4
+            case Codec::Lz4:
+                return true;
+#endif
+#ifdef KOUTA_USE_ZSTD
+            case Codec::Zstd:
+                return true;
+#endif
+            default:
+                return false;
+        }
+    }
+
+    /// @brief Block compressor.
+    ///
+    /// @details
+    /// The compression context and output buffer are kept between blocks, so that compressing a block does not
+    /// allocate memory once the buffer has grown to the largest block size.
+    ///
+    /// @note The compressor is **not thread-safe**, each thread should use its own.
+    class Compressor
+    {
+    public:
+        // Not default-constructible.
+        Compressor() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] codec            Codec to use.
+        /// @param[in] level            Codec-specific level (acceleration factor for LZ4, compression level for zstd),
+        ///                             or `0` to use the default one.
+        ///
+        /// @throws std::invalid_argument if the codec was not enabled at build time.
+        explicit Compressor(Codec codec, int level = 0)
+            : m_codec{codec}
+            , m_level{level}
+            , m_buffer{}
+#ifdef KOUTA_USE_LZ4
+            , m_lz4{nullptr, &LZ4_freeStream}
+#endif
+#ifdef KOUTA_USE_ZSTD
+            , m_zstd{nullptr, &ZSTD_freeCCtx}
+#endif
+        {
+            if (!available(codec))
+            {
+                throw std::invalid_argument("compression codec not available");
+            }
+
+#ifdef KOUTA_USE_LZ4
+            if (codec == Codec::Lz4)
+            {
+                m_lz4.reset(LZ4_createStream());
+                m_level = (level > 0) ? level : 1;
+            }
+#endif
+
+#ifdef KOUTA_USE_ZSTD
+            if (codec == Codec::Zstd)
+            {
+                m_zstd.reset(ZSTD_createCCtx());
+                m_level = (level != 0) ? level : ZSTD_CLEVEL_DEFAULT;
+            }
+#endif
+        }
+
+        // Not copyable
+        Compressor(const Compressor&) = delete;
+        Compressor& operator=(const Compressor&) = delete;
+
+        // Movable
+        Compressor(Compressor&&) = default;
+        Compressor& operator=(Compressor&&) = default;
+
+        virtual ~Compressor() = default;
+
+        /// @brief Obtain the codec in use.
+        Codec codec() const
+        {
+            return m_codec;
+        }
+
+        /// @brief Compress a block.
+        ///
+        /// @param[in] input            Block to compress.
+        ///
+        /// @returns View over the compressed block, valid until the next call.
+        ///
+        /// @throws std::runtime_error if the block cannot be compressed.
+        std::span<const std::uint8_t> compress(std::span<const std::uint8_t> input)
+        {
+            switch (m_codec)
+            {
+#ifdef KOUTA_USE_LZ4
+                case Codec::Lz4:
+                {
+                    if (input.size() > LZ4_MAX_INPUT_SIZE)
+                    {
+                        throw std::runtime_error("block too large");
+                    }
+
+                    int size{static_cast<int>(input.size())};
+
+                    grow(static_cast<std::size_t>(LZ4_compressBound(size)));
+
+                    // Blocks are independent, hence the dictionary is discarded
+                    LZ4_resetStream_fast(m_lz4.get());
+
+                    int result{LZ4_compress_fast_continue(m_lz4.get(),
+                                                          reinterpret_cast<const char*>(input.data()),
+                                                          reinterpret_cast<char*>(m_buffer.data()),
+                                                          size,
+                                                          static_cast<int>(m_buffer.size()),
+                                                          m_level)};
+
+                    if (result <= 0)
+                    {
+                        throw std::runtime_error("failed to compress block");
+                    }
+
+                    return std::span<const std::uint8_t>{m_buffer}.first(static_cast<std::size_t>(result));
+                }
+#endif
+#ifdef KOUTA_USE_ZSTD
+                case Codec::Zstd:
+                {
+                    grow(ZSTD_compressBound(input.size()));
+
+                    std::size_t result{ZSTD_compressCCtx(
+                        m_zstd.get(), m_buffer.data(), m_buffer.size(), input.data(), input.size(), m_level)};
+
+                    if (ZSTD_isError(result))
+                    {
+                        throw std::runtime_error("failed to compress block");
+                    }
+
+                    return std::span<const std::uint8_t>{m_buffer}.first(result);
+                }
+#endif
+                default:
+                    return input;
+            }
+        }
+
+    private:
+        /// @brief Grow the output buffer to hold at least @p count bytes.
+        void grow(std::size_t count)
+        {
+            if (m_buffer.size() < count)
+            {
+                m_buffer.resize(count);
+            }
+        }
+
+        Codec m_codec;
+        int m_level;
+        std::vector<std::uint8_t> m_buffer;
+#ifdef KOUTA_USE_LZ4
+        std::unique_ptr<LZ4_stream_t, int (*)(LZ4_stream_t*)> m_lz4;
+#endif
+#ifdef KOUTA_USE_ZSTD
+        std::unique_ptr<ZSTD_CCtx, std::size_t (*)(ZSTD_CCtx*)> m_zstd;
+#endif
+    };
+
+    /// @brief Block decompressor.
+    ///
+    /// @details
+    /// Blocks are decompressed into a buffer kept between blocks, and exposed through @ref Parser views. The
+    /// decompression context is created when first required, and reused afterwards.
+    ///
+    /// @note The decompressor is **not thread-safe**, each thread should use its own.
+    class Decompressor
+    {
+    public:
+        /// @brief Default constructor.
+        Decompressor()
+            : m_buffer{}
+#ifdef KOUTA_USE_ZSTD
+            , m_zstd{nullptr, &ZSTD_freeDCtx}
+#endif
+        {
+        }
+
+        // Not copyable
+        Decompressor(const Decompressor&) = delete;
+        Decompressor& operator=(const Decompressor&) = delete;
+
+        // Movable
+        Decompressor(Decompressor&&) = default;
+        Decompressor& operator=(Decompressor&&) = default;
+
+        virtual ~Decompressor() = default;
+
+        /// @brief Decompress a block.
+        ///
+        /// @param[in] codec            Codec used to compress the block.
+        /// @param[in] input            Compressed block.
+        /// @param[in] size             Size of the block before compression.
+        ///
+        /// @returns Parser over the decompressed block, valid until the next call.
+        ///
+        /// @throws std::invalid_argument if the codec was not enabled at build time.
+        /// @throws std::runtime_error if the block is corrupted or its size does not match @p size.
+        Parser decompress(Codec codec, std::span<const std::uint8_t> input, std::size_t size)
+        {
+            if (!available(codec))
+            {
+                throw std::invalid_argument("compression codec not available");
+            }
+
+            switch (codec)
+            {
+#ifdef KOUTA_USE_LZ4
+                case Codec::Lz4:
+                {
+                    if (size > LZ4_MAX_INPUT_SIZE)
+                    {
+                        throw std::runtime_error("corrupted compressed block");
+                    }
+
+                    grow(size);
+
+                    int result{LZ4_decompress_safe(reinterpret_cast<const char*>(input.data()),
+                                                   reinterpret_cast<char*>(m_buffer.data()),
+                                                   static_cast<int>(input.size()),
+                                                   static_cast<int>(size))};
+
+                    if (result < 0 || static_cast<std::size_t>(result) != size)
+                    {
+                        throw std::runtime_error("corrupted compressed block");
+                    }
+
+                    return Parser{std::span<const std::uint8_t>{m_buffer}.first(size)};
+                }
+#endif
+#ifdef KOUTA_USE_ZSTD
+                case Codec::Zstd:
+                {
+                    if (!m_zstd)
+                    {
+                        m_zstd.reset(ZSTD_createDCtx());
+                    }
+
+                    grow(size);
+
+                    std::size_t result{
+                        ZSTD_decompressDCtx(m_zstd.get(), m_buffer.data(), size, input.data(), input.size())};
+
+                    if (ZSTD_isError(result) || result != size)
+                    {
+                        throw std::runtime_error("corrupted compressed block");
+                    }
+
+                    return Parser{std::span<const std::uint8_t>{m_buffer}.first(size)};
+                }
+#endif
+                default:
+                    if (input.size() != size)
+                    {
+                        throw std::runtime_error("corrupted compressed block");
+                    }
+
+                    return Parser{input};
+            }
+        }
+
+    private:
+        /// @brief Grow the output buffer to hold at least @p count bytes.
+        void grow(std::size_t count)
+        {
+            // Avoid handing out a null pointer for empty blocks
+            count = std::max<std::size_t>(count, 1);
+
+            if (m_buffer.size() < count)
+            {
+                m_buffer.resize(count);
+            }
+        }
+
+        std::vector<std::uint8_t> m_buffer;
+#ifdef KOUTA_USE_ZSTD
+        std::unique_ptr<ZSTD_DCtx, std::size_t (*)(ZSTD_DCtx*)> m_zstd;
+#endif
+    };
+}  // namespace kouta::io::compression
@@ -0,0 +1,543 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+
+#include <kouta/base/asio.hpp>
+#include <kouta/base/callback.hpp>
+#include <kouta/base/component.hpp>
+#include <kouta/io/packer.hpp>
+#include <kouta/io/parser.hpp>
+
+// Available since Linux 4.18 (UDP_SEGMENT) and 5.0 (UDP_GRO), but not always exposed by the C library
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+namespace kouta::io
+{
+    /// @brief Received datagram.
+    struct Datagram
+    {
+        /// Endpoint the datagram was received from.
+        base::asio::ip::udp::endpoint endpoint;
+        /// Parser over the contents of the datagram.
+        Parser parser;
+    };
+
+    /// @brief Component that exchanges UDP datagrams in batches.
+    ///
+    /// @details
+    /// The DatagramComponent owns a UDP socket that uses the event loop of its parent. Instead of issuing an
+    /// asynchronous operation per datagram, it waits for the socket to become readable and then moves up to
+    /// @ref batch_size() datagrams per system call (`recvmmsg()`) into a pre-allocated slab, delivering each batch
+    /// through a single callback invocation.
+    ///
+    /// Outgoing datagrams are queued, and all the datagrams queued within the same event loop iteration are sent with
+    /// as few system calls as possible (`sendmmsg()`).
+    ///
+    /// Optionally, generic receive offload (GRO) can be enabled, in which case the kernel may coalesce several
+    /// datagrams from the same flow into a single buffer that is split again before delivery. Likewise,
+    /// @ref send_segmented() relies on generic segmentation offload (GSO) to send a buffer as several datagrams of the
+    /// same size with a single system call.
+    ///
+    /// The socket must be opened (and bound, if required) through @ref socket() before calling @ref start().
+    ///
+    /// @note This component is only available on Linux.
+    ///
+    /// @note As any other component, the DatagramComponent is **not thread-safe** and must only be used from within its
+    /// event loop.
+    class DatagramComponent : public base::Component
+    {
+    public:
+        /// Type of the underlying socket.
+        using Socket = base::asio::ip::udp::socket;
+        /// Type of the endpoints.
+        using Endpoint = base::asio::ip::udp::endpoint;
+        /// Callback to invoke for each received batch. The parsers are only valid during the invocation.
+        using OnReceived = base::Callback<std::span<const Datagram>>;
+        /// Callback to invoke when a receive or send operation fails.
+        using OnError = base::Callback<const base::asio::error_code&>;
+
+        /// Default maximum number of datagrams per system call.
+        static constexpr std::size_t DefaultBatchSize{64};
+        /// Default maximum size of a received datagram.
+        static constexpr std::size_t DefaultDatagramSize{2048};
+        /// Size of the receive buffers when GRO is enabled (coalesced datagrams may take up to 64 KiB).
+        static constexpr std::size_t GroBufferSize{65536};
+
+        // Not default-constructible.
+        DatagramComponent() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] parent           Parent component granting access to the event loop.
+        /// @param[in] on_received      Callback to invoke for each received batch.
+        /// @param[in] on_error         Callback to invoke when a receive or send operation fails. Receiving is stopped
+        ///                             after an error, while a datagram that cannot be sent is dropped (the following
+        ///                             ones are still sent).
+        /// @param[in] batch_size       Maximum number of datagrams per system call.
+        /// @param[in] datagram_size    Maximum size of a received datagram. Larger datagrams are truncated.
+        /// @param[in] gro              Whether to enable generic receive offload.
+        DatagramComponent(
+            base::Component* parent,
+            OnReceived on_received,
+            OnError on_error,
+            std::size_t batch_size = DefaultBatchSize,
+            std::size_t datagram_size = DefaultDatagramSize,
+            bool gro = false)
+            : base::Component{parent}
+            , m_socket{context()}
+            , m_on_received{std::move(on_received)}
+            , m_on_error{std::move(on_error)}
+            , m_gro{gro}
+            , m_receiving{false}
+            , m_slot_size{gro ? GroBufferSize : datagram_size}
+            , m_slab(batch_size * m_slot_size)
+            , m_rx_addresses(batch_size)
+            , m_rx_control(batch_size * ControlSize)
+            , m_rx_iovecs(batch_size)
+            , m_rx_headers(batch_size)
+            , m_datagrams{}
+            , m_queued{}
+            , m_tx_iovecs{}
+            , m_tx_control{}
+            , m_tx_headers{}
+            , m_flush_scheduled{false}
+            , m_writing{false}
+        {
+            for (std::size_t i = 0; i < batch_size; i++)
+            {
+                m_rx_iovecs[i] = {m_slab.data() + (i * m_slot_size), m_slot_size};
+            }
+
+            m_datagrams.reserve(batch_size);
+        }
+
+        // Not copyable
+        DatagramComponent(const DatagramComponent&) = delete;
+        DatagramComponent& operator=(const DatagramComponent&) = delete;
+
+        // Not movable
+        DatagramComponent(DatagramComponent&&) = delete;
+        DatagramComponent& operator=(DatagramComponent&&) = delete;
+
+        ~DatagramComponent() override = default;
+
+        /// @brief Obtain a reference to the underlying socket (e.g. to open or bind it).
+        Socket& socket()
+        {
+            return m_socket;
+        }
+
+        /// @brief Obtain the maximum number of datagrams per system call.
+        std::size_t batch_size() const
+        {
+            return m_rx_headers.size();
+        }
+
+        /// @brief Start receiving datagrams.
+        ///
+        /// @note This has no effect if the component is already receiving.
+        ///
+        /// @throws asio::system_error if GRO was requested but could not be enabled.
+        void start()
+        {
+            if (m_receiving)
+            {
+                return;
+            }
+
+            if (m_gro)
+            {
+                int enable{1};
+
+                if (::setsockopt(m_socket.native_handle(), IPPROTO_UDP, UDP_GRO, &enable, sizeof(enable)) < 0)
+                {
+                    throw base::asio::system_error{last_error(), "failed to enable UDP GRO"};
+                }
+            }
+
+            m_receiving = true;
+            wait_read();
+        }
+
+        /// @brief Close the socket, cancelling the pending operations and discarding the queued datagrams.
+        void close()
+        {
+            base::asio::error_code ec{};
+
+            m_socket.close(ec);
+            m_receiving = false;
+            m_writing = false;
+            m_queued.clear();
+        }
+
+        /// @brief Queue a datagram to be sent.
+        ///
+        /// @details
+        /// The queued datagrams are sent in batches once the current event loop iteration completes.
+        ///
+        /// @param[in] endpoint         Destination of the datagram.
+        /// @param[in] packer           Packer containing the datagram.
+        void send(const Endpoint& endpoint, Packer packer)
+        {
+            send_segmented(endpoint, std::move(packer), 0);
+        }
+
+        /// @brief Queue a buffer to be sent as several datagrams of the same size (GSO).
+        ///
+        /// @details
+        /// The kernel splits the buffer in datagrams of @p segment_size bytes (the last one may be shorter), which
+        /// avoids traversing the network stack once per datagram.
+        ///
+        /// @param[in] endpoint         Destination of the datagrams.
+        /// @param[in] packer           Packer containing the buffer.
+        /// @param[in] segment_size     Size of each datagram, or zero to send the buffer as a single datagram.
+        void send_segmented(const Endpoint& endpoint, Packer packer, std::uint16_t segment_size)
+        {
+            m_queued.push_back({endpoint, std::move(packer), segment_size});
+
+            if (!m_flush_scheduled && !m_writing)
+            {
+                m_flush_scheduled = true;
+                post(
+                    [this]()
+                    {
+                        m_flush_scheduled = false;
+                        flush();
+                    });
+            }
+        }
+
+        /// @brief Obtain the number of datagrams that have not been sent yet.
+        std::size_t pending() const
+        {
+            return m_queued.size();
+        }
+
+    private:
+        /// Size of the control buffer of each message.
+        static constexpr std::size_t ControlSize{CMSG_SPACE(sizeof(int))};
+
+        /// @brief Datagram waiting to be sent.
+        struct Outgoing
+        {
+            Endpoint endpoint;
+            Packer packer;
+            std::uint16_t segment_size;
+        };
+
+        /// @brief Obtain the error code corresponding to `errno`.
+        static base::asio::error_code last_error()
+        {
+            return base::asio::error_code{errno, base::asio::error::get_system_category()};
+        }
+
+        /// @brief Wait for the socket to become readable.
+        void wait_read()
+        {
+            m_socket.async_wait(
+                Socket::wait_read,
+                base::asio::bind_executor(executor(), std::bind_front(&DatagramComponent::handle_readable, this)));
+        }
+
+        /// @brief Receive all the available datagrams in batches.
+        ///
+        /// @param[in] ec               Error code of the wait operation.
+        void handle_readable(const base::asio::error_code& ec)
+        {
+            if (ec == base::asio::error::operation_aborted)
+            {
+                return;
+            }
+
+            if (ec)
+            {
+                m_receiving = false;
+                m_on_error(ec);
+                return;
+            }
+
+            int count{0};
+
+            do
+            {
+                count = receive_batch();
+
+                if (count < 0)
+                {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                    {
+                        break;
+                    }
+
+                    m_receiving = false;
+                    m_on_error(last_error());
+                    return;
+                }
+
+                deliver_batch(static_cast<std::size_t>(count));
+            }
+            // A full batch means there may be more datagrams waiting
+            while (m_receiving && static_cast<std::size_t>(count) == batch_size());
+
+            if (m_receiving)
+            {
+                wait_read();
+            }
+        }
+
+        /// @brief Receive a batch of datagrams into the slab.
+        ///
+        /// @returns Number of datagrams received, or -1 on error (see `errno`).
+        int receive_batch()
+        {
+            for (std::size_t i = 0; i < batch_size(); i++)
+            {
+                auto& hdr{m_rx_headers[i].msg_hdr};
+
+                hdr.msg_name = &m_rx_addresses[i];
+                hdr.msg_namelen = sizeof(::sockaddr_storage);
+                hdr.msg_iov = &m_rx_iovecs[i];
+                hdr.msg_iovlen = 1;
+                hdr.msg_control = m_gro ? m_rx_control.data() + (i * ControlSize) : nullptr;
+                hdr.msg_controllen = m_gro ? ControlSize : 0;
+                hdr.msg_flags = 0;
+            }
+
+            return ::recvmmsg(
+                m_socket.native_handle(),
+                m_rx_headers.data(),
+                static_cast<unsigned int>(batch_size()),
+                MSG_DONTWAIT,
+                nullptr);
+        }
+
+        /// @brief Deliver a batch of received datagrams through the callback.
+        ///
+        /// @details
+        /// Buffers coalesced by GRO are split in datagrams of the segment size reported by the kernel.
+        ///
+        /// @param[in] count            Number of messages received.
+        void deliver_batch(std::size_t count)
+        {
+            m_datagrams.clear();
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                const auto& hdr{m_rx_headers[i].msg_hdr};
+                Endpoint endpoint{};
+                Parser::View view{m_slab.data() + (i * m_slot_size), m_rx_headers[i].msg_len};
+
+                std::memcpy(endpoint.data(), hdr.msg_name, hdr.msg_namelen);
+                endpoint.resize(hdr.msg_namelen);
+
+                std::size_t segment_size{segment_size_of(hdr)};
+
+                if (segment_size == 0 || segment_size >= view.size())
+                {
+                    m_datagrams.push_back({endpoint, Parser{view}});
+                    continue;
+                }
+
+                for (std::size_t offset = 0; offset < view.size(); offset += segment_size)
+                {
+                    m_datagrams.push_back(
+                        {endpoint, Parser{view.subspan(offset, std::min(segment_size, view.size() - offset))}});
+                }
+            }
+
+            if (!m_datagrams.empty())
+            {
+                m_on_received(std::span<const Datagram>{m_datagrams});
+            }
+        }
+
+        /// @brief Obtain the GRO segment size of a received message, or zero if it was not coalesced.
+        static std::size_t segment_size_of(const ::msghdr& hdr)
+        {
+            if (hdr.msg_control == nullptr)
+            {
+                return 0;
+            }
+
+            auto& mutable_hdr{const_cast<::msghdr&>(hdr)};
+
+            for (auto* cmsg = CMSG_FIRSTHDR(&mutable_hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&mutable_hdr, cmsg))
+            {
+                if (cmsg->cmsg_level == IPPROTO_UDP && cmsg->cmsg_type == UDP_GRO)
+                {
+                    int segment_size{0};
+
+                    std::memcpy(&segment_size, CMSG_DATA(cmsg), sizeof(segment_size));
+
+                    return static_cast<std::size_t>(segment_size);
+                }
+            }
+
+            return 0;
+        }
+
+        /// @brief Send the queued datagrams in batches.
+        ///
+        /// @details
+        /// If the socket buffer is full, sending is resumed once the socket becomes writable.
+        ///
+        /// `sendmmsg()` only fails when the first message of the batch cannot be sent (otherwise, it reports the number
+        /// of messages sent before the failing one). Hence, on error, only the first unsent datagram is dropped, and
+        /// the remaining ones are retried.
+        void flush()
+        {
+            std::size_t sent{0};
+
+            while (sent < m_queued.size())
+            {
+                std::size_t count{std::min(batch_size(), m_queued.size() - sent)};
+
+                prepare_batch(sent, count);
+
+                int result{::sendmmsg(
+                    m_socket.native_handle(),
+                    m_tx_headers.data(),
+                    static_cast<unsigned int>(count),
+                    MSG_DONTWAIT)};
+
+                if (result < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    {
+                        break;
+                    }
+
+                    auto error{last_error()};
+
+                    // Discard the sent datagrams and the failing one before notifying, as the callback may queue (or
+                    // discard) datagrams
+                    m_queued.erase(m_queued.begin(), m_queued.begin() + static_cast<std::ptrdiff_t>(sent + 1));
+                    sent = 0;
+                    m_on_error(error);
+
+                    if (!m_socket.is_open())
+                    {
+                        return;
+                    }
+
+                    continue;
+                }
+
+                sent += static_cast<std::size_t>(result);
+            }
+
+            m_queued.erase(m_queued.begin(), m_queued.begin() + static_cast<std::ptrdiff_t>(sent));
+
+            if (!m_queued.empty())
+            {
+                m_writing = true;
+                m_socket.async_wait(
+                    Socket::wait_write,
+                    base::asio::bind_executor(executor(), std::bind_front(&DatagramComponent::handle_writable, this)));
+            }
+        }
+
+        /// @brief Resume sending once the socket becomes writable.
+        ///
+        /// @param[in] ec               Error code of the wait operation.
+        void handle_writable(const base::asio::error_code& ec)
+        {
+            if (ec == base::asio::error::operation_aborted)
+            {
+                return;
+            }
+
+            m_writing = false;
+
+            if (ec)
+            {
+                m_queued.clear();
+                m_on_error(ec);
+                return;
+            }
+
+            flush();
+        }
+
+        /// @brief Fill the message headers for a batch of queued datagrams.
+        ///
+        /// @param[in] first            Index of the first queued datagram of the batch.
+        /// @param[in] count            Number of datagrams in the batch.
+        void prepare_batch(std::size_t first, std::size_t count)
+        {
+            m_tx_headers.resize(count);
+            m_tx_iovecs.resize(count);
+            m_tx_control.resize(count * ControlSize);
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                auto& outgoing{m_queued[first + i]};
+                auto& hdr{m_tx_headers[i].msg_hdr};
+
+                m_tx_iovecs[i] = {outgoing.packer.data().data(), outgoing.packer.size()};
+
+                hdr = {};
+                hdr.msg_name = outgoing.endpoint.data();
+                hdr.msg_namelen = static_cast<::socklen_t>(outgoing.endpoint.size());
+                hdr.msg_iov = &m_tx_iovecs[i];
+                hdr.msg_iovlen = 1;
+
+                if (outgoing.segment_size > 0)
+                {
+                    hdr.msg_control = m_tx_control.data() + (i * ControlSize);
+                    hdr.msg_controllen = CMSG_SPACE(sizeof(std::uint16_t));
+
+                    auto* cmsg{CMSG_FIRSTHDR(&hdr)};
+
+                    cmsg->cmsg_level = IPPROTO_UDP;
+                    cmsg->cmsg_type = UDP_SEGMENT;
+                    cmsg->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+                    std::memcpy(CMSG_DATA(cmsg), &outgoing.segment_size, sizeof(outgoing.segment_size));
+                }
+            }
+        }
+
+        Socket m_socket;
+        OnReceived m_on_received;
+        OnError m_on_error;
+        bool m_gro;
+        bool m_receiving;
+        std::size_t m_slot_size;
+        std::vector<std::uint8_t> m_slab;
+        std::vector<::sockaddr_storage> m_rx_addresses;
+        std::vector<std::uint8_t> m_rx_control;
+        std::vector<::iovec> m_rx_iovecs;
+        std::vector<::mmsghdr> m_rx_headers;
+        std::vector<Datagram> m_datagrams;
+        std::vector<Outgoing> m_queued;
+        std::vector<::iovec> m_tx_iovecs;
+        std::vector<std::uint8_t> m_tx_control;
+        std::vector<::mmsghdr> m_tx_headers;
+        bool m_flush_scheduled;
+        bool m_writing;
+    };
+}  // namespace kouta::io
+
+#endif
@@ -0,0 +1,341 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <kouta/io/parser.hpp>
+
+namespace kouta::io
+{
+    /// @brief Streaming frame decoder.
+    ///
+    /// @details
+    /// The FrameDecoder accumulates bytes received from a stream (e.g. a TCP socket or a serial port) and splits them
+    /// into frames according to a framing function (see @ref Framer), emitting a @ref Parser for each complete frame.
+    ///
+    /// Bytes are appended at the end of an internal buffer, either by copying them with @ref push() or by reading
+    /// them directly into the region returned by @ref prepare() and confirming them with @ref commit(). Frames are
+    /// consumed from the beginning of the buffer, and the bytes of a trailing incomplete frame are only moved to the
+    /// front of the buffer once there is no room left at the end, so that each byte is copied at most once in the
+    /// common case and frames are always contiguous.
+    ///
+    /// The parsers returned by @ref next() point to the internal buffer, hence they are **only valid until the next
+    /// call to @ref prepare(), @ref push() or @ref clear()**.
+    ///
+    /// @note The decoder is **not thread-safe**.
+    class FrameDecoder
+    {
+    public:
+        /// Underlying view data type.
+        using View = Parser::View;
+        /// Endian ordering
+        using Order = Parser::Order;
+
+        /// @brief Framing function.
+        ///
+        /// @details
+        /// The function receives a parser over the buffered bytes (which always start at a frame boundary) and returns
+        /// the size of the first frame, or `std::nullopt` if more bytes are required to determine it. The returned
+        /// size may exceed the number of buffered bytes, in which case the decoder waits for the rest of the frame.
+        ///
+        /// Functions that scan the bytes (e.g. looking for a delimiter) may also accept the number of bytes that were
+        /// already scanned, as a second `std::size_t&` argument. The decoder keeps it while the frame is incomplete
+        /// and resets it when the frame is consumed, so that each byte is only scanned once even if the frame arrives
+        /// over many reads.
+        class Framer
+        {
+        public:
+            /// Underlying function type.
+            using Function = std::function<std::optional<std::size_t>(const Parser&, std::size_t&)>;
+
+            /// @brief Construct from a function that resumes scanning.
+            ///
+            /// @param[in] function     Function invocable as `function(pending, scanned)`.
+            template<class TFunction>
+                requires(!std::is_same_v<TFunction, Framer>
+                         && std::is_invocable_r_v<std::optional<std::size_t>, TFunction&, const Parser&, std::size_t&>)
+            Framer(TFunction function)
+                : m_function{std::move(function)}
+            {
+            }
+
+            /// @brief Construct from a function that always looks at the whole pending bytes.
+            ///
+            /// @param[in] function     Function invocable as `function(pending)`.
+            template<class TFunction>
+                requires(!std::is_same_v<TFunction, Framer>
+                         && !std::is_invocable_v<TFunction&, const Parser&, std::size_t&>
+                         && std::is_invocable_r_v<std::optional<std::size_t>, TFunction&, const Parser&>)
+            Framer(TFunction function)
+                : m_function{[function = std::move(function)](const Parser& pending, std::size_t&) mutable
+                             {
+                                 return function(pending);
+                             }}
+            {
+            }
+
+            /// @brief Determine the size of the first frame, resuming after the bytes already scanned.
+            std::optional<std::size_t> operator()(const Parser& pending, std::size_t& scanned) const
+            {
+                return m_function(pending, scanned);
+            }
+
+            /// @brief Determine the size of the first frame, scanning the pending bytes from the start.
+            std::optional<std::size_t> operator()(const Parser& pending) const
+            {
+                std::size_t scanned{0};
+
+                return m_function(pending, scanned);
+            }
+
+        private:
+            Function m_function;
+        };
+
+        /// Default initial capacity of the internal buffer.
+        static constexpr std::size_t DefaultCapacity{4096};
+
+        // Not default-constructible.
+        FrameDecoder() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] framer           Framing function.
+        /// @param[in] capacity         Initial capacity of the internal buffer. The buffer grows if a frame does not
+        ///                             fit in it.
+        /// @param[in] max_frame_size   Maximum size of a frame. Larger frames are treated as errors, which prevents the
+        ///                             buffer from growing indefinitely on malformed streams.
+        explicit FrameDecoder(
+            Framer framer,
+            std::size_t capacity = DefaultCapacity,
+            std::size_t max_frame_size = std::numeric_limits<std::size_t>::max())
+            : m_framer{std::move(framer)}
+            , m_buffer(capacity)
+            , m_head{0}
+            , m_tail{0}
+            , m_scanned{0}
+            , m_max_frame_size{max_frame_size}
+        {
+        }
+
+        // Copyable
+        FrameDecoder(const FrameDecoder&) = default;
+        FrameDecoder& operator=(const FrameDecoder&) = default;
+
+        // Movable
+        FrameDecoder(FrameDecoder&&) = default;
+        FrameDecoder& operator=(FrameDecoder&&) = default;
+
+        virtual ~FrameDecoder() = default;
+
+        /// @brief Create a framing function for frames terminated by a delimiter.
+        ///
+        /// @note The delimiter is included in the frame.
+        ///
+        /// @param[in] delimiter        Byte that terminates a frame.
+        static Framer delimiter(std::uint8_t delimiter)
+        {
+            return [delimiter](const Parser& pending, std::size_t& scanned) -> std::optional<std::size_t>
+            {
+                const auto& view{pending.view()};
+                const auto* found{static_cast<const std::uint8_t*>(
+                    std::memchr(view.data() + scanned, delimiter, view.size() - scanned))};
+
+                if (!found)
+                {
+                    scanned = view.size();
+                    return std::nullopt;
+                }
+
+                return static_cast<std::size_t>(found - view.data()) + 1;
+            };
+        }
+
+        /// @brief Create a framing function for frames with a length field.
+        ///
+        /// @details
+        /// The size of the frame is computed as `offset + N + length + adjustment`, meaning that by default the length
+        /// field is expected to contain the number of bytes that follow it. The @p adjustment can be used, for
+        /// instance, when the length also includes the header or does not include a trailing checksum.
+        ///
+        /// @tparam TLength             Numerical type of the length field.
+        /// @tparam N                   Number of bytes of the length field.
+        /// @tparam Endian              Endian order of the length field.
+        ///
+        /// @param[in] offset           Offset of the length field within the frame.
+        /// @param[in] adjustment       Number of bytes to add to the frame size.
+        ///
+        /// @throws std::length_error (when decoding) if the resulting frame size is smaller than the length field.
+        template<std::unsigned_integral TLength, std::size_t N = sizeof(TLength), Order Endian = Order::big>
+        static Framer length_prefix(std::size_t offset = 0, std::ptrdiff_t adjustment = 0)
+        {
+            return [offset, adjustment](const Parser& pending) -> std::optional<std::size_t>
+            {
+                std::size_t header{offset + N};
+
+                if (pending.size() < header)
+                {
+                    return std::nullopt;
+                }
+
+                auto length{static_cast<std::ptrdiff_t>(pending.extract_integral<TLength, N, Endian>(offset))};
+
+                if ((length + adjustment) < 0)
+                {
+                    throw std::length_error("invalid frame length");
+                }
+
+                return header + static_cast<std::size_t>(length + adjustment);
+            };
+        }
+
+        /// @brief Obtain a writable region of at least @p count bytes at the end of the buffer.
+        ///
+        /// @details
+        /// This allows reading data directly into the decoder (e.g. with `async_read_some()`). The bytes written must
+        /// then be confirmed with @ref commit().
+        ///
+        /// @warning This invalidates the parsers previously returned by @ref next().
+        ///
+        /// @param[in] count            Minimum number of bytes to make room for.
+        ///
+        /// @returns Writable region.
+        std::span<std::uint8_t> prepare(std::size_t count)
+        {
+            if ((m_buffer.size() - m_tail) < count)
+            {
+                // Move the pending bytes to the front of the buffer
+                if (m_head > 0)
+                {
+                    std::memmove(m_buffer.data(), m_buffer.data() + m_head, m_tail - m_head);
+                    m_tail -= m_head;
+                    m_head = 0;
+                }
+
+                if ((m_buffer.size() - m_tail) < count)
+                {
+                    m_buffer.resize(std::max(m_tail + count, m_buffer.size() * 2));
+                }
+            }
+
+            return std::span<std::uint8_t>{m_buffer.data() + m_tail, m_buffer.size() - m_tail};
+        }
+
+        /// @brief Confirm that @p count bytes were written to the region returned by @ref prepare().
+        ///
+        /// @param[in] count            Number of bytes written.
+        ///
+        /// @throws std::out_of_range when @p count exceeds the size of the region.
+        void commit(std::size_t count)
+        {
+            if ((m_tail + count) > m_buffer.size())
+            {
+                throw std::out_of_range("committed more bytes than prepared");
+            }
+
+            m_tail += count;
+        }
+
+        /// @brief Append a copy of the given bytes to the buffer.
+        ///
+        /// @warning This invalidates the parsers previously returned by @ref next().
+        ///
+        /// @param[in] view             Bytes to append.
+        void push(const View& view)
+        {
+            if (view.empty())
+            {
+                return;
+            }
+
+            auto region{prepare(view.size())};
+
+            std::memcpy(region.data(), view.data(), view.size());
+            commit(view.size());
+        }
+
+        /// @brief Obtain the next complete frame, if any.
+        ///
+        /// @details
+        /// The frame is consumed from the buffer, but its bytes remain valid until the next call to @ref prepare(),
+        /// @ref push() or @ref clear().
+        ///
+        /// @returns Parser over the frame, or `std::nullopt` if there is no complete frame.
+        ///
+        /// @throws std::length_error when the frame exceeds the maximum frame size, or its size is zero.
+        std::optional<Parser> next()
+        {
+            if (m_head == m_tail)
+            {
+                return std::nullopt;
+            }
+
+            Parser pending_parser{pending()};
+            auto frame_size{m_framer(pending_parser, m_scanned)};
+
+            if (!frame_size)
+            {
+                if (pending_parser.size() >= m_max_frame_size)
+                {
+                    throw std::length_error("frame exceeds maximum size");
+                }
+
+                return std::nullopt;
+            }
+
+            if (*frame_size == 0 || *frame_size > m_max_frame_size)
+            {
+                throw std::length_error("invalid frame size");
+            }
+
+            if (*frame_size > pending_parser.size())
+            {
+                return std::nullopt;
+            }
+
+            Parser frame{pending_parser.extract_bytes(0, *frame_size)};
+
+            m_head += *frame_size;
+            m_scanned = 0;
+
+            return frame;
+        }
+
+        /// @brief Obtain a view over the buffered bytes that have not been consumed yet.
+        View pending() const
+        {
+            return View{m_buffer.data() + m_head, m_tail - m_head};
+        }
+
+        /// @brief Obtain the current capacity of the internal buffer.
+        std::size_t capacity() const
+        {
+            return m_buffer.size();
+        }
+
+        /// @brief Discard all the buffered bytes (e.g. to resynchronize after an error).
+        void clear()
+        {
+            m_head = 0;
+            m_tail = 0;
+            m_scanned = 0;
+        }
+
+    private:
+        Framer m_framer;
+        std::vector<std::uint8_t> m_buffer;
+        std::size_t m_head;
+        std::size_t m_tail;
+        std::size_t m_scanned;
+        std::size_t m_max_frame_size;
+    };
+}  // namespace kouta::io
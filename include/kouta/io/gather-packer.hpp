@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <kouta/base/asio.hpp>
+#include <kouta/io/packer.hpp>
+
+namespace kouta::io
+{
+    /// @brief Scatter/gather binary data packer.
+    ///
+    /// @details
+    /// This class exposes the same API as the @ref Packer, but avoids copying large byte sequences into the
+    /// underlying data container. Instead, sequences of at least @ref threshold() bytes inserted through
+    /// @ref insert_bytes(const std::span<const std::uint8_t>&) are kept as references, while the rest of the fields
+    /// are packed inline as usual.
+    ///
+    /// The resulting message is exposed as a sequence of buffers (see @ref buffers()) that interleaves the inline data
+    /// and the referenced sequences, which can be written at once with a gather operation (e.g. `asio::write()`,
+    /// which results in a single `writev()`/`sendmsg()` call).
+    ///
+    /// @note The inline data returned by @ref data() **does not include** the referenced sequences.
+    ///
+    /// Offsets given to the inherited methods (e.g. @ref Packer::patch_length() or @ref Packer::append_checksum())
+    /// refer to the inline data, and the sequences referenced within the given ranges are taken into account. A
+    /// sequence referenced at a given offset precedes the inline byte at that offset.
+    ///
+    /// @warning The packer **does not own the referenced memory**, whose lifetime must surpass that of the packer
+    /// (or at least the gather operation).
+    class GatherPacker : public Packer
+    {
+    public:
+        /// Sequence of buffers that make up the message.
+        using Buffers = std::vector<base::asio::const_buffer>;
+        /// View over a referenced byte sequence.
+        using View = std::span<const std::uint8_t>;
+
+        /// Default minimum size of the byte sequences that are referenced instead of copied.
+        static constexpr std::size_t DefaultThreshold{256};
+
+        /// @brief Default constructor.
+        ///
+        /// @details
+        /// Uses the @ref DefaultThreshold.
+        GatherPacker()
+            : GatherPacker{DefaultThreshold}
+        {
+        }
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] threshold        Minimum size of the byte sequences that are referenced instead of copied.
+        /// @param[in] count            Number of bytes to pre-allocate for the inline data.
+        explicit GatherPacker(std::size_t threshold, std::size_t count = 0)
+            : Packer{count}
+            , m_threshold{threshold}
+            , m_references{}
+            , m_buffers{}
+        {
+        }
+
+        // Copyable
+        GatherPacker(const GatherPacker&) = default;
+        GatherPacker& operator=(const GatherPacker&) = default;
+
+        // Movable
+        GatherPacker(GatherPacker&&) = default;
+        GatherPacker& operator=(GatherPacker&&) = default;
+
+        ~GatherPacker() override = default;
+
+        /// @brief Obtain the minimum size of the byte sequences that are referenced instead of copied.
+        std::size_t threshold() const
+        {
+            return m_threshold;
+        }
+
+        /// @brief Obtain the size of the whole message.
+        ///
+        /// @note This includes both the inline data and the referenced sequences.
+        std::size_t size() const override
+        {
+            std::size_t total{data().size()};
+
+            for (const auto& ref : m_references)
+            {
+                total += ref.view.size();
+            }
+
+            return total;
+        }
+
+        /// @brief Inherit the remaining @ref Packer::insert_bytes() overloads, which always copy.
+        using Packer::insert_bytes;
+
+        /// @brief Insert the bytes given by the span @p view in the message.
+        ///
+        /// @details
+        /// If the span has at least @ref threshold() bytes, it is referenced instead of copied.
+        ///
+        /// @param[in] view         View to insert.
+        void insert_bytes(const View& view)
+        {
+            if (view.size() < m_threshold)
+            {
+                Packer::insert_bytes(view);
+            }
+            else
+            {
+                insert_reference(view);
+            }
+        }
+
+        /// @brief Insert a reference to the bytes given by the span @p view in the message, regardless of its size.
+        ///
+        /// @param[in] view         View to reference.
+        void insert_reference(const View& view)
+        {
+            if (!view.empty())
+            {
+                m_references.emplace_back(data().size(), view);
+            }
+        }
+
+        /// @brief Obtain the sequence of buffers that make up the message.
+        ///
+        /// @details
+        /// The returned reference is valid until the next call to this method, and the buffers it contains are valid
+        /// as long as no other data is inserted in the packer.
+        const Buffers& buffers()
+        {
+            m_buffers.clear();
+
+            visit(0,
+                  data().size(),
+                  [this](std::span<const std::uint8_t> segment)
+                  {
+                      m_buffers.emplace_back(segment.data(), segment.size());
+                  });
+
+            return m_buffers;
+        }
+
+        /// @brief Remove all inline data and references, so that the packer can be reused.
+        ///
+        /// @note Allocated memory is kept.
+        void clear()
+        {
+            data().clear();
+            m_references.clear();
+            m_buffers.clear();
+        }
+
+    protected:
+        /// @brief Visit the inline data and the referenced sequences within a range of the inline data, in order.
+        ///
+        /// @details
+        /// Sequences referenced at the end of the range are only visited if the range extends to the end of the inline
+        /// data.
+        void visit(std::size_t first, std::size_t last, const Visitor& visitor) const override
+        {
+            const std::uint8_t* inline_data{data().data()};
+            std::size_t position{first};
+
+            for (const auto& ref : m_references)
+            {
+                if (ref.offset < first)
+                {
+                    continue;
+                }
+
+                if (ref.offset > last || (ref.offset == last && last < data().size()))
+                {
+                    break;
+                }
+
+                if (ref.offset > position)
+                {
+                    visitor(std::span<const std::uint8_t>{inline_data + position, ref.offset - position});
+                    position = ref.offset;
+                }
+
+                visitor(ref.view);
+            }
+
+            if (last > position)
+            {
+                visitor(std::span<const std::uint8_t>{inline_data + position, last - position});
+            }
+        }
+
+    private:
+        /// @brief Referenced byte sequence.
+        struct Reference
+        {
+            /// Offset within the inline data at which the sequence is inserted.
+            std::size_t offset;
+            /// Referenced sequence.
+            View view;
+        };
+
+        std::size_t m_threshold;
+        std::vector<Reference> m_references;
+        Buffers m_buffers;
+    };
+}  // namespace kouta::io
@@ -0,0 +1,590 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/endian.hpp>
+
+#include <kouta/io/parser.hpp>
+#include <kouta/io/varint.hpp>
+
+namespace kouta::io
+{
+    /// @brief Memory-mapped file.
+    ///
+    /// @details
+    /// The MappedFile maps the contents of a file into memory (`mmap()`), so that they can be accessed through
+    /// @ref Parser views without reading them into the heap. Pages are loaded on demand by the kernel, which can be
+    /// guided through @ref advise() (e.g. to read ahead aggressively when processing the file sequentially).
+    ///
+    /// The mapping is released when the object is destroyed.
+    ///
+    /// @note This class relies on POSIX APIs.
+    class MappedFile
+    {
+    public:
+        /// Read-only view over the mapping.
+        using View = std::span<const std::uint8_t>;
+
+        /// @brief Access mode.
+        enum class Mode
+        {
+            /// Open an existing file for reading.
+            ReadOnly,
+            /// Open an existing file for reading and writing.
+            ReadWrite,
+            /// Create a file (truncating it if it exists) for reading and writing.
+            Create,
+        };
+
+        /// @brief Access pattern hint (see `madvise()`).
+        enum class Advice
+        {
+            /// No special treatment.
+            Normal,
+            /// Pages will be accessed sequentially (aggressive read-ahead).
+            Sequential,
+            /// Pages will be accessed randomly (no read-ahead).
+            Random,
+            /// Pages will be accessed soon (start loading them).
+            WillNeed,
+            /// Pages will not be accessed soon (they may be freed).
+            DontNeed,
+        };
+
+        // Not default-constructible.
+        MappedFile() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] path             Path of the file to map.
+        /// @param[in] mode             Access mode.
+        ///
+        /// @throws std::system_error if the file cannot be opened or mapped.
+        explicit MappedFile(const std::filesystem::path& path, Mode mode = Mode::ReadOnly)
+            : m_fd{-1}
+            , m_data{nullptr}
+            , m_size{0}
+            , m_writable{mode != Mode::ReadOnly}
+        {
+            int flags{O_RDONLY};
+
+            if (mode == Mode::ReadWrite)
+            {
+                flags = O_RDWR;
+            }
+            else if (mode == Mode::Create)
+            {
+                flags = O_RDWR | O_CREAT | O_TRUNC;
+            }
+
+            m_fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+
+            if (m_fd < 0)
+            {
+                throw_error("failed to open " + path.string());
+            }
+
+            struct ::stat info{};
+
+            if (::fstat(m_fd, &info) < 0)
+            {
+                int error{errno};
+
+                ::close(m_fd);
+                throw std::system_error{error, std::generic_category(), "failed to stat " + path.string()};
+            }
+
+            try
+            {
+                map(static_cast<std::size_t>(info.st_size));
+            }
+            catch (...)
+            {
+                ::close(m_fd);
+                throw;
+            }
+        }
+
+        // Not copyable
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Movable
+        MappedFile(MappedFile&& other) noexcept
+            : m_fd{std::exchange(other.m_fd, -1)}
+            , m_data{std::exchange(other.m_data, nullptr)}
+            , m_size{std::exchange(other.m_size, 0)}
+            , m_writable{other.m_writable}
+        {
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+
+                m_fd = std::exchange(other.m_fd, -1);
+                m_data = std::exchange(other.m_data, nullptr);
+                m_size = std::exchange(other.m_size, 0);
+                m_writable = other.m_writable;
+            }
+
+            return *this;
+        }
+
+        virtual ~MappedFile()
+        {
+            release();
+        }
+
+        /// @brief Obtain the size of the file.
+        std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /// @brief Check whether the mapping can be written to.
+        bool writable() const
+        {
+            return m_writable;
+        }
+
+        /// @brief Obtain a read-only view over the whole mapping.
+        View view() const
+        {
+            return View{m_data, m_size};
+        }
+
+        /// @brief Obtain a writable view over the whole mapping.
+        ///
+        /// @throws std::logic_error if the file was opened in read-only mode.
+        std::span<std::uint8_t> data()
+        {
+            if (!m_writable)
+            {
+                throw std::logic_error("file is not writable");
+            }
+
+            return {m_data, m_size};
+        }
+
+        /// @brief Obtain a parser over the whole mapping.
+        Parser parser() const
+        {
+            return Parser{view()};
+        }
+
+        /// @brief Obtain a parser over a region of the mapping.
+        ///
+        /// @param[in] offset           Offset of the region.
+        /// @param[in] count            Size of the region.
+        ///
+        /// @throws std::out_of_range if the region is not within the mapping.
+        Parser parser(std::size_t offset, std::size_t count) const
+        {
+            return Parser{parser().extract_bytes(offset, count)};
+        }
+
+        /// @brief Give a hint about how a region of the mapping will be accessed.
+        ///
+        /// @param[in] advice           Access pattern.
+        /// @param[in] offset           Offset of the region (rounded down to a page boundary).
+        /// @param[in] count            Size of the region, defaults to the rest of the mapping.
+        ///
+        /// @throws std::system_error if the hint cannot be applied.
+        void advise(Advice advice, std::size_t offset = 0, std::size_t count = std::string::npos)
+        {
+            if (m_size == 0 || offset >= m_size)
+            {
+                return;
+            }
+
+            // The address must be page-aligned
+            std::size_t page{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+            std::size_t start{(offset / page) * page};
+            std::size_t end{count > (m_size - offset) ? m_size : offset + count};
+
+            if (::madvise(m_data + start, end - start, to_native(advice)) < 0)
+            {
+                throw_error("failed to advise mapping");
+            }
+        }
+
+        /// @brief Change the size of the file, remapping it.
+        ///
+        /// @warning This invalidates all the views and parsers obtained from the mapping.
+        ///
+        /// @param[in] size             New size of the file.
+        ///
+        /// @throws std::logic_error if the file was opened in read-only mode.
+        /// @throws std::system_error if the file cannot be resized or remapped.
+        void resize(std::size_t size)
+        {
+            if (!m_writable)
+            {
+                throw std::logic_error("file is not writable");
+            }
+
+            if (size == m_size)
+            {
+                return;
+            }
+
+            if (::ftruncate(m_fd, static_cast<::off_t>(size)) < 0)
+            {
+                throw_error("failed to resize file");
+            }
+
+#if defined(__linux__)
+            if (m_data && size > 0)
+            {
+                void* data{::mremap(m_data, m_size, size, MREMAP_MAYMOVE)};
+
+                if (data == MAP_FAILED)
+                {
+                    throw_error("failed to remap file");
+                }
+
+                m_data = static_cast<std::uint8_t*>(data);
+                m_size = size;
+
+                return;
+            }
+#endif
+
+            unmap();
+            map(size);
+        }
+
+        /// @brief Flush the changes made to the mapping to the file.
+        ///
+        /// @throws std::system_error if the changes cannot be flushed.
+        void sync()
+        {
+            if (m_data && ::msync(m_data, m_size, MS_SYNC) < 0)
+            {
+                throw_error("failed to sync mapping");
+            }
+        }
+
+    private:
+        /// @brief Throw a system error from `errno`.
+        [[noreturn]] static void throw_error(const std::string& what)
+        {
+            throw std::system_error{errno, std::generic_category(), what};
+        }
+
+        /// @brief Convert an advice to its native value.
+        static int to_native(Advice advice)
+        {
+            switch (advice)
+            {
+                case Advice::Sequential:
+                    return MADV_SEQUENTIAL;
+                case Advice::Random:
+                    return MADV_RANDOM;
+                case Advice::WillNeed:
+                    return MADV_WILLNEED;
+                case Advice::DontNeed:
+                    return MADV_DONTNEED;
+                default:
+                    return MADV_NORMAL;
+            }
+        }
+
+        /// @brief Map the given number of bytes of the file.
+        ///
+        /// @note Empty files are not mapped.
+        void map(std::size_t size)
+        {
+            m_size = size;
+
+            if (size == 0)
+            {
+                m_data = nullptr;
+                return;
+            }
+
+            int protection{m_writable ? (PROT_READ | PROT_WRITE) : PROT_READ};
+            void* data{::mmap(nullptr, size, protection, MAP_SHARED, m_fd, 0)};
+
+            if (data == MAP_FAILED)
+            {
+                m_size = 0;
+                throw_error("failed to map file");
+            }
+
+            m_data = static_cast<std::uint8_t*>(data);
+        }
+
+        /// @brief Release the mapping, if any.
+        void unmap()
+        {
+            if (m_data)
+            {
+                ::munmap(m_data, m_size);
+            }
+
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+        /// @brief Release the mapping and the file descriptor.
+        void release()
+        {
+            unmap();
+
+            if (m_fd >= 0)
+            {
+                ::close(m_fd);
+                m_fd = -1;
+            }
+        }
+
+        int m_fd;
+        std::uint8_t* m_data;
+        std::size_t m_size;
+        bool m_writable;
+    };
+
+    /// @brief Binary data packer that writes into a memory-mapped file.
+    ///
+    /// @details
+    /// This class exposes the same insertion API as the @ref Packer, but writes directly into a @ref MappedFile that
+    /// grows as needed (doubling its size and remapping it), so that large files can be generated without keeping
+    /// their contents in the heap.
+    ///
+    /// Since the file grows in steps, it is truncated to the number of bytes actually written in @ref finish(), which
+    /// is also called on destruction.
+    class MappedPacker
+    {
+    public:
+        /// Endian ordering
+        using Order = boost::endian::order;
+
+        /// Default initial size of the file.
+        static constexpr std::size_t DefaultCapacity{1024 * 1024};
+
+        // Not default-constructible.
+        MappedPacker() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @details
+        /// The file is created, or truncated if it already exists.
+        ///
+        /// @param[in] path             Path of the file to write.
+        /// @param[in] capacity         Initial size of the file.
+        ///
+        /// @throws std::system_error if the file cannot be created or mapped.
+        explicit MappedPacker(const std::filesystem::path& path, std::size_t capacity = DefaultCapacity)
+            : m_file{path, MappedFile::Mode::Create}
+            , m_size{0}
+            , m_finished{false}
+        {
+            m_file.resize(std::max<std::size_t>(capacity, 1));
+        }
+
+        // Not copyable
+        MappedPacker(const MappedPacker&) = delete;
+        MappedPacker& operator=(const MappedPacker&) = delete;
+
+        // Movable
+        //
+        // The moved-from packer is left finished, so that it does not touch the file anymore. Move-assigning over a
+        // packer finishes it first.
+        MappedPacker(MappedPacker&& other) noexcept
+            : m_file{std::move(other.m_file)}
+            , m_size{std::exchange(other.m_size, 0)}
+            , m_finished{std::exchange(other.m_finished, true)}
+        {
+        }
+
+        MappedPacker& operator=(MappedPacker&& other) noexcept
+        {
+            if (this != &other)
+            {
+                finish_quietly();
+
+                m_file = std::move(other.m_file);
+                m_size = std::exchange(other.m_size, 0);
+                m_finished = std::exchange(other.m_finished, true);
+            }
+
+            return *this;
+        }
+
+        virtual ~MappedPacker()
+        {
+            finish_quietly();
+        }
+
+        /// @brief Obtain the number of bytes written.
+        std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /// @brief Obtain the current size of the underlying file.
+        std::size_t capacity() const
+        {
+            return m_file.size();
+        }
+
+        /// @brief Obtain a read-only view over the bytes written.
+        ///
+        /// @warning The view is invalidated when the file grows.
+        MappedFile::View view() const
+        {
+            return m_file.view().first(m_size);
+        }
+
+        /// @brief Insert an integral value in the file.
+        ///
+        /// @tparam TValue          The numerical type to insert.
+        /// @tparam N               Number of bytes to insert.
+        /// @tparam Endian          Endian order of the value to insert.
+        ///
+        /// @param[in] value        Value to insert.
+        template<std::integral TValue, std::size_t N = sizeof(TValue), Order Endian = Order::big>
+        void insert_integral(TValue value)
+        {
+            // Assumes 8 bits per byte
+            boost::endian::endian_buffer<Endian, TValue, N * 8> buf{value};
+
+            write(buf.data(), N);
+        }
+
+        /// @brief Insert a variable-length integer (LEB128) in the file.
+        ///
+        /// @tparam TValue          The numerical type to insert.
+        ///
+        /// @param[in] value        Value to insert.
+        template<varint::Integer TValue>
+        void insert_varint(TValue value)
+        {
+            std::uint8_t buf[varint::max_size<TValue>];
+
+            write(buf, varint::encode(value, buf));
+        }
+
+        /// @brief Insert a floating point value in the file.
+        ///
+        /// @tparam TValue          The numerical type to insert.
+        /// @tparam Endian          Endian order of the value to insert.
+        ///
+        /// @param[in] value        Value to insert.
+        template<std::floating_point TValue, Order Endian = Order::big>
+        void insert_floating_point(TValue value)
+        {
+            // Assumes 8 bits per byte
+            boost::endian::endian_buffer<Endian, TValue, sizeof(TValue) * 8> buf{value};
+
+            write(buf.data(), sizeof(TValue));
+        }
+
+        /// @brief Insert a string value in the file.
+        ///
+        /// @note The final null-character is ignored.
+        ///
+        /// @param[in] value        Value to insert.
+        void insert_string(const std::string& value)
+        {
+            write(value.data(), value.size());
+        }
+
+        /// @brief Insert a single byte in the file.
+        ///
+        /// @param[in] value        Value to insert.
+        void insert_byte(std::uint8_t value)
+        {
+            write(&value, 1);
+        }
+
+        /// @brief Insert the bytes given by the span @p view in the file.
+        ///
+        /// @details
+        /// This can be used to append the contents of a @ref Packer (e.g. a record whose fields were patched).
+        ///
+        /// @param[in] view         View to insert.
+        void insert_bytes(const std::span<const std::uint8_t>& view)
+        {
+            write(view.data(), view.size());
+        }
+
+        /// @brief Truncate the file to the number of bytes written and flush it.
+        ///
+        /// @note No more data may be inserted afterwards.
+        ///
+        /// @throws std::system_error if the file cannot be truncated or flushed.
+        void finish()
+        {
+            if (m_finished)
+            {
+                return;
+            }
+
+            m_finished = true;
+            m_file.resize(m_size);
+            m_file.sync();
+        }
+
+    private:
+        /// @brief Finish the packer, ignoring errors (e.g. when it is destroyed).
+        void finish_quietly() noexcept
+        {
+            try
+            {
+                finish();
+            }
+            catch (...)
+            {
+                // Nothing to do at this point
+            }
+        }
+
+        /// @brief Copy bytes at the end of the written data, growing the file if required.
+        ///
+        /// @throws std::logic_error if the packer was already finished.
+        void write(const void* data, std::size_t count)
+        {
+            if (m_finished)
+            {
+                throw std::logic_error("packer already finished");
+            }
+
+            if (count == 0)
+            {
+                return;
+            }
+
+            if ((m_size + count) > m_file.size())
+            {
+                m_file.resize(std::max(m_size + count, m_file.size() * 2));
+            }
+
+            std::memcpy(m_file.data().data() + m_size, data, count);
+            m_size += count;
+        }
+
+        MappedFile m_file;
+        std::size_t m_size;
+        bool m_finished;
+    };
+}  // namespace kouta::io
@@ -1,15 +1,23 @@
 #pragma once
 
+#include <algorithm>
 #include <concepts>
 #include <cstdint>
+#include <functional>
 #include <initializer_list>
+#include <limits>
+#include <optional>
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <boost/endian.hpp>
 
+#include <kouta/io/checksum.hpp>
+#include <kouta/io/varint.hpp>
+
 namespace kouta::io
 {
     /// @brief Binary data packer.
@@ -24,6 +32,45 @@ namespace kouta::io
         /// Endian ordering
         using Order = boost::endian::order;
 
+        /// @brief Handle to a region reserved in the data container.
+        ///
+        /// @details
+        /// Placeholders are obtained through @ref reserve() and can be filled at a later point through @ref patch()
+        /// and related methods, once the value to store is known (e.g. the length of the frame).
+        ///
+        /// @tparam TValue          The numerical type to store in the region.
+        /// @tparam N               Number of bytes reserved.
+        /// @tparam Endian          Endian order of the value to store.
+        template<std::integral TValue, std::size_t N = sizeof(TValue), Order Endian = Order::big>
+        class Placeholder
+        {
+        public:
+            /// Type of the value to store.
+            using ValueType = TValue;
+
+            /// Number of bytes reserved.
+            static constexpr std::size_t Size{N};
+
+            /// @brief Obtain the offset of the region in the data container.
+            std::size_t offset() const
+            {
+                return m_offset;
+            }
+
+        private:
+            friend class Packer;
+
+            /// @brief Constructor.
+            ///
+            /// @param[in] offset       Offset of the region in the data container.
+            explicit Placeholder(std::size_t offset)
+                : m_offset{offset}
+            {
+            }
+
+            std::size_t m_offset;
+        };
+
         /// @brief Default constructor.
         ///
         /// @details
@@ -63,10 +110,11 @@ namespace kouta::io
             return m_data;
         }
 
-        /// @brief Obtain the size of the internal data container.
+        /// @brief Obtain the size of the message.
         ///
-        /// @note This also corresponds to the number of bytes.
-        std::size_t size() const
+        /// @note For the Packer, this corresponds to the size of the internal data container. Derived packers that do
+        /// not store the whole message in it (e.g. the @ref GatherPacker) override this method.
+        virtual std::size_t size() const
         {
             return m_data.size();
         }
@@ -89,6 +137,25 @@ namespace kouta::io
             m_data.insert(m_data.end(), buf.data(), buf.data() + N);
         }
 
+        /// @brief Insert a variable-length integer (LEB128) in the data container.
+        ///
+        /// @details
+        /// Each byte carries 7 bits of the value, meaning that small values take fewer bytes than their fixed-width
+        /// representation. Signed values are ZigZag-encoded (see @ref varint::zigzag_encode()) so that small negative
+        /// values are also encoded in few bytes.
+        ///
+        /// @tparam TValue          The numerical type to insert in the data container.
+        ///
+        /// @param[in] value        Value to insert.
+        template<varint::Integer TValue>
+        void insert_varint(TValue value)
+        {
+            std::uint8_t buf[varint::max_size<TValue>];
+            std::size_t count{varint::encode(value, buf)};
+
+            m_data.insert(m_data.end(), buf, buf + count);
+        }
+
         /// @brief Insert a floating point value in the data container.
         ///
         /// @tparam TValue          The numerical type to insert in the data container.
@@ -152,6 +219,249 @@ namespace kouta::io
             m_data.insert(m_data.end(), view.begin(), view.end());
         }
 
+        /// @brief Append the checksum of the data container.
+        ///
+        /// @details
+        /// The checksum is computed over the bytes from @p offset up to the end of the message, and inserted right after
+        /// them.
+        ///
+        /// @tparam TAlgorithm      Checksum algorithm (see @ref checksum::Algorithm).
+        /// @tparam Endian          Endian order of the checksum.
+        ///
+        /// @param[in] offset       Offset from which to start computing the checksum.
+        ///
+        /// @throws std::out_of_range when @p offset is not within the data container.
+        template<checksum::Algorithm TAlgorithm, Order Endian = Order::big>
+        void append_checksum(std::size_t offset = 0)
+        {
+            check_bounds(offset, 0);
+
+            auto value{TAlgorithm::compute(std::span<const std::uint8_t>{})};
+
+            visit(offset,
+                  m_data.size(),
+                  [&value](std::span<const std::uint8_t> segment)
+                  {
+                      value = TAlgorithm::compute(segment, value);
+                  });
+
+            insert_integral<typename TAlgorithm::Value, TAlgorithm::Size, Endian>(value);
+        }
+
+        /// @brief Reserve room for an integral value in the data container.
+        ///
+        /// @details
+        /// The reserved bytes are zero-initialized, and can be filled later on through the returned placeholder.
+        ///
+        /// @tparam TValue          The numerical type to reserve room for.
+        /// @tparam N               Number of bytes to reserve.
+        /// @tparam Endian          Endian order of the value to store.
+        ///
+        /// @returns Placeholder for the reserved region.
+        template<std::integral TValue, std::size_t N = sizeof(TValue), Order Endian = Order::big>
+        Placeholder<TValue, N, Endian> reserve()
+        {
+            Placeholder<TValue, N, Endian> placeholder{m_data.size()};
+
+            m_data.insert(m_data.end(), N, std::uint8_t{0});
+
+            return placeholder;
+        }
+
+        /// @brief Store a value in a reserved region of the data container.
+        ///
+        /// @tparam TValue          The numerical type to store.
+        /// @tparam N               Number of bytes reserved.
+        /// @tparam Endian          Endian order of the value to store.
+        ///
+        /// @param[in] placeholder  Placeholder of the reserved region.
+        /// @param[in] value        Value to store.
+        ///
+        /// @throws std::out_of_range when the reserved region is no longer within the data container.
+        template<std::integral TValue, std::size_t N, Order Endian>
+        void patch(const Placeholder<TValue, N, Endian>& placeholder, std::type_identity_t<TValue> value)
+        {
+            check_bounds(placeholder.offset(), N);
+
+            boost::endian::endian_store<TValue, N, Endian>(&m_data[placeholder.offset()], value);
+        }
+
+        /// @brief Store the length of the data that follows a reserved region.
+        ///
+        /// @details
+        /// The length is computed as the number of bytes from @p offset up to the end of the message. By default, this
+        /// corresponds to the bytes that follow the reserved region.
+        ///
+        /// @tparam TValue          The numerical type to store.
+        /// @tparam N               Number of bytes reserved.
+        /// @tparam Endian          Endian order of the value to store.
+        ///
+        /// @param[in] placeholder  Placeholder of the reserved region.
+        /// @param[in] offset       Offset from which to start counting. If not specified, the end of the reserved
+        ///                         region is used.
+        ///
+        /// @throws std::out_of_range when the reserved region or @p offset are no longer within the data container.
+        /// @throws std::overflow_error when the length does not fit in the reserved region.
+        template<std::integral TValue, std::size_t N, Order Endian>
+        void patch_length(const Placeholder<TValue, N, Endian>& placeholder, std::optional<std::size_t> offset = {})
+        {
+            std::size_t first{offset.value_or(placeholder.offset() + N)};
+
+            check_bounds(first, 0);
+
+            std::size_t length{0};
+
+            visit(first,
+                  m_data.size(),
+                  [&length](std::span<const std::uint8_t> segment)
+                  {
+                      length += segment.size();
+                  });
+
+            patch_value(placeholder, length);
+        }
+
+        /// @brief Store the checksum of a region of the data container.
+        ///
+        /// @details
+        /// The checksum is computed over @p count bytes starting at @p offset. By default, this corresponds to the
+        /// bytes that follow the reserved region. The region covered by the checksum must not overlap the reserved
+        /// one.
+        ///
+        /// If the region is not contiguous in memory (see @ref GatherPacker), it is copied to a temporary buffer before
+        /// invoking the checksum function.
+        ///
+        /// @tparam TValue          The numerical type to store.
+        /// @tparam N               Number of bytes reserved.
+        /// @tparam Endian          Endian order of the value to store.
+        /// @tparam TChecksum       Checksum function type. It must be invocable with a `std::span<const std::uint8_t>`
+        ///                         and return an integral value.
+        ///
+        /// @param[in] placeholder  Placeholder of the reserved region.
+        /// @param[in] checksum     Checksum function.
+        /// @param[in] offset       Offset from which to start computing the checksum. If not specified, the end of the
+        ///                         reserved region is used.
+        /// @param[in] count        Number of bytes to compute the checksum over. If not specified, the checksum is
+        ///                         computed up to the end of the data container.
+        ///
+        /// @throws std::out_of_range when the reserved region or the checksum region are not within the data container.
+        /// @throws std::invalid_argument when the checksum region overlaps the reserved region.
+        /// @throws std::overflow_error when the checksum does not fit in the reserved region.
+        template<std::integral TValue, std::size_t N, Order Endian, class TChecksum>
+            requires std::invocable<TChecksum&, std::span<const std::uint8_t>>
+        void patch_crc(
+            const Placeholder<TValue, N, Endian>& placeholder,
+            TChecksum&& checksum,
+            std::optional<std::size_t> offset = {},
+            std::optional<std::size_t> count = {})
+        {
+            std::size_t first{offset.value_or(placeholder.offset() + N)};
+
+            check_bounds(first, 0);
+
+            std::size_t length{count.value_or(m_data.size() - first)};
+
+            check_bounds(first, length);
+
+            if (first < (placeholder.offset() + N) && placeholder.offset() < (first + length))
+            {
+                throw std::invalid_argument("checksum region overlaps placeholder");
+            }
+
+            std::span<const std::uint8_t> region{m_data.data() + first, 0};
+            std::size_t segments{0};
+            Container joined{};
+
+            visit(first,
+                  first + length,
+                  [&](std::span<const std::uint8_t> segment)
+                  {
+                      if (segments == 1)
+                      {
+                          joined.assign(region.begin(), region.end());
+                      }
+
+                      if (segments++ == 0)
+                      {
+                          region = segment;
+                      }
+                      else
+                      {
+                          joined.insert(joined.end(), segment.begin(), segment.end());
+                      }
+                  });
+
+            if (segments > 1)
+            {
+                region = joined;
+            }
+
+            patch_value(placeholder, checksum(region));
+        }
+
+    protected:
+        /// Function invoked for each contiguous segment of the message.
+        using Visitor = std::function<void(std::span<const std::uint8_t>)>;
+
+        /// @brief Visit the segments of the message that correspond to a range of the data container, in order.
+        ///
+        /// @details
+        /// For the Packer, this is a single segment of the data container. Derived packers that insert bytes outside
+        /// of it (e.g. the @ref GatherPacker) override this method to also visit them.
+        ///
+        /// @param[in] first            Offset of the first byte of the range.
+        /// @param[in] last             Offset past the last byte of the range.
+        /// @param[in] visitor          Function to invoke for each segment.
+        virtual void visit(std::size_t first, std::size_t last, const Visitor& visitor) const
+        {
+            visitor(std::span<const std::uint8_t>{m_data.data() + first, last - first});
+        }
+
+        /// @brief Store a computed value in a reserved region, checking that it fits.
+        ///
+        /// @throws std::out_of_range when the reserved region is no longer within the data container.
+        /// @throws std::overflow_error when the value does not fit in the reserved region.
+        template<std::integral TValue, std::size_t N, Order Endian, std::integral TComputed>
+        void patch_value(const Placeholder<TValue, N, Endian>& placeholder, TComputed value)
+        {
+            using Unsigned = std::make_unsigned_t<TValue>;
+
+            // Signed placeholders keep their sign bit clear, so that the stored value does not read back as negative
+            constexpr std::size_t Bits{std::min(N, sizeof(TValue)) * 8 - (std::is_signed_v<TValue> ? 1 : 0)};
+            constexpr Unsigned max{(Bits >= (sizeof(TValue) * 8))
+                                       ? std::numeric_limits<Unsigned>::max()
+                                       : static_cast<Unsigned>((Unsigned{1} << Bits) - 1)};
+
+            if constexpr (std::is_signed_v<TComputed>)
+            {
+                if (value < 0)
+                {
+                    throw std::overflow_error("value does not fit in placeholder");
+                }
+            }
+
+            if (static_cast<std::make_unsigned_t<TComputed>>(value) > max)
+            {
+                throw std::overflow_error("value does not fit in placeholder");
+            }
+
+            patch(placeholder, static_cast<TValue>(value));
+        }
+
+        /// @brief Check that a specific range is within the data container.
+        ///
+        /// @param[in] offset           Starting offset.
+        /// @param[in] count            Number of bytes in the range.
+        ///
+        /// @throws std::out_of_range when the range is not within the data container.
+        void check_bounds(std::size_t offset, std::size_t count) const
+        {
+            if ((offset + count) > m_data.size())
+            {
+                throw std::out_of_range("range not within data");
+            }
+        }
+
     private:
         Container m_data;
     };
@@ -2,12 +2,18 @@
 
 #include <concepts>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include <boost/endian.hpp>
 
+#include <kouta/io/checksum.hpp>
+#include <kouta/io/varint.hpp>
+
 namespace kouta::io
 {
     /// @brief Binary data parser.
@@ -119,6 +125,119 @@ namespace kouta::io
             return buf.value();
         }
 
+        /// @brief Extract a variable-length integer (LEB128) from the view.
+        ///
+        /// @details
+        /// Signed values are expected to be ZigZag-encoded (see @ref varint::zigzag_encode()), which is what
+        /// @ref Packer::insert_varint() produces.
+        ///
+        /// Values encoded in one or two bytes (i.e. unsigned values below 16384) are decoded without entering the
+        /// generic decoding loop.
+        ///
+        /// @tparam TValue          The numerical type to extract from the data view.
+        ///
+        /// @param[in] offset       The offset from which to start extracting data.
+        /// @param[out] count       Number of bytes the encoded value occupies.
+        ///
+        /// @returns Integral value
+        ///
+        /// @throws std::out_of_range when there are not enough bytes in the data view.
+        /// @throws std::overflow_error when the encoded value does not fit in @p TValue.
+        template<varint::Integer TValue>
+        TValue extract_varint(std::size_t offset, std::size_t& count) const
+        {
+            using Unsigned = std::make_unsigned_t<TValue>;
+
+            check_bounds(offset, 1);
+
+            const std::uint8_t* data{m_view.data() + offset};
+            std::size_t available{size() - offset};
+            std::uint64_t raw{};
+
+            if (data[0] < 0x80)
+            {
+                // Single byte
+                count = 1;
+                raw = data[0];
+            }
+            else if (available >= 2 && data[1] < 0x80)
+            {
+                // Two bytes
+                count = 2;
+                raw = (data[0] & std::uint64_t{0x7F}) | (std::uint64_t{data[1]} << 7);
+            }
+            else
+            {
+                raw = decode_varint(data, available, count);
+            }
+
+            if (raw > std::numeric_limits<Unsigned>::max())
+            {
+                throw std::overflow_error("varint does not fit in type");
+            }
+
+            if constexpr (std::is_signed_v<TValue>)
+            {
+                return varint::zigzag_decode(static_cast<Unsigned>(raw));
+            }
+            else
+            {
+                return static_cast<TValue>(raw);
+            }
+        }
+
+        /// @brief Extract a variable-length integer (LEB128) from the view.
+        ///
+        /// @details
+        /// Same as @ref extract_varint(std::size_t, std::size_t&), for when the size of the encoded value is not
+        /// required.
+        ///
+        /// @tparam TValue          The numerical type to extract from the data view.
+        ///
+        /// @param[in] offset       The offset from which to start extracting data.
+        ///
+        /// @returns Integral value
+        ///
+        /// @throws std::out_of_range when there are not enough bytes in the data view.
+        /// @throws std::overflow_error when the encoded value does not fit in @p TValue.
+        template<varint::Integer TValue>
+        TValue extract_varint(std::size_t offset) const
+        {
+            std::size_t count{};
+
+            return extract_varint<TValue>(offset, count);
+        }
+
+        /// @brief Extract a sequence of consecutive variable-length integers (LEB128) from the view.
+        ///
+        /// @details
+        /// As many values as fit in @p values are extracted.
+        ///
+        /// @tparam TValue          The numerical type to extract from the data view.
+        ///
+        /// @param[in] offset       The offset from which to start extracting data.
+        /// @param[out] values      Destination of the extracted values.
+        ///
+        /// @returns Number of bytes the encoded values occupy.
+        ///
+        /// @throws std::out_of_range when there are not enough bytes in the data view.
+        /// @throws std::overflow_error when an encoded value does not fit in @p TValue.
+        template<varint::Integer TValue>
+        std::size_t extract_varints(std::size_t offset, std::span<TValue> values) const
+        {
+            std::size_t position{offset};
+
+            for (auto& value : values)
+            {
+                std::size_t count{};
+
+                value = extract_varint<TValue>(position, count);
+                position += count;
+            }
+
+            return position - offset;
+        }
+
         /// @brief Extract a string value from the view.
         ///
         /// @details
@@ -144,7 +263,149 @@ namespace kouta::io
             return std::string{src_it, src_it + count};
         }
 
+        /// @brief Extract a string view from the view.
+        ///
+        /// @details
+        /// The @p offset must be within bounds, considering the character @p count specified.
+        ///
+        /// As opposed to @ref extract_string(), no memory is allocated: the returned view points to the underlying
+        /// data, hence it is only valid as long as said data is.
+        ///
+        /// @param offset       The starting offset from which to start extracting data.
+        /// @param count        The number of characters/bytes to extract from the view.
+        ///
+        /// @returns String view over the underlying data.
+        ///
+        /// @throws std::out_of_range when there are not enough bytes in the data view.
+        std::string_view extract_string_view(std::size_t offset, std::size_t count) const
+        {
+            check_bounds(offset, count);
+
+            return std::string_view{reinterpret_cast<const char*>(m_view.data() + offset), count};
+        }
+
+        /// @brief Extract a null-terminated string view from the view.
+        ///
+        /// @details
+        /// The string starts at @p offset and extends up to (but not including) the first null-character found. If
+        /// there is no null-character, the string extends until the end of the view.
+        ///
+        /// As opposed to @ref extract_string(), no memory is allocated: the returned view points to the underlying
+        /// data, hence it is only valid as long as said data is.
+        ///
+        /// @param offset       The starting offset from which to start extracting data.
+        ///
+        /// @returns String view over the underlying data, without the null-character.
+        ///
+        /// @throws std::out_of_range when the offset is not within the data view.
+        std::string_view extract_cstring_view(std::size_t offset) const
+        {
+            check_bounds(offset, 0);
+
+            std::size_t available{size() - offset};
+
+            if (available == 0)
+            {
+                return std::string_view{};
+            }
+
+            const auto* first{m_view.data() + offset};
+            const auto* terminator{static_cast<const std::uint8_t*>(std::memchr(first, 0, available))};
+
+            return std::string_view{
+                reinterpret_cast<const char*>(first),
+                terminator ? static_cast<std::size_t>(terminator - first) : available};
+        }
+
+        /// @brief Extract a sequence of bytes from the view.
+        ///
+        /// @details
+        /// The @p offset must be within bounds, considering the byte @p count specified.
+        ///
+        /// The returned view points to the underlying data, hence it is only valid as long as said data is. It may be
+        /// used to construct a nested @ref Parser for a sub-sequence of the data.
+        ///
+        /// @param offset       The starting offset from which to start extracting data.
+        /// @param count        The number of bytes to extract from the view.
+        ///
+        /// @returns View over the underlying data.
+        ///
+        /// @throws std::out_of_range when there are not enough bytes in the data view.
+        View extract_bytes(std::size_t offset, std::size_t count) const
+        {
+            check_bounds(offset, count);
+
+            return m_view.subspan(offset, count);
+        }
+
+        /// @brief Verify the checksum of a region of the view.
+        ///
+        /// @details
+        /// The checksum is computed over @p count bytes starting at @p offset, and compared against the one stored
+        /// right after them (as appended by @ref Packer::append_checksum()).
+        ///
+        /// @tparam TAlgorithm      Checksum algorithm (see @ref checksum::Algorithm).
+        /// @tparam Endian          Endian order of the stored checksum.
+        ///
+        /// @param[in] offset       Offset from which to start computing the checksum.
+        /// @param[in] count        Number of bytes to compute the checksum over.
+        ///
+        /// @returns Whether the computed checksum matches the stored one.
+        ///
+        /// @throws std::out_of_range when there are not enough bytes in the data view.
+        template<checksum::Algorithm TAlgorithm, Order Endian = Order::big>
+        bool verify_checksum(std::size_t offset, std::size_t count) const
+        {
+            check_bounds(offset, count + TAlgorithm::Size);
+
+            auto expected{extract_integral<typename TAlgorithm::Value, TAlgorithm::Size, Endian>(offset + count)};
+
+            return TAlgorithm::compute(m_view.subspan(offset, count)) == expected;
+        }
+
     private:
+        /// @brief Decode a variable-length integer of arbitrary size.
+        ///
+        /// @param[in] data             Beginning of the encoded value.
+        /// @param[in] available        Number of bytes that may be read from @p data.
+        /// @param[out] count           Number of bytes the encoded value occupies.
+        ///
+        /// @returns Decoded raw (unsigned) value.
+        ///
+        /// @throws std::out_of_range when there are not enough bytes in the data view.
+        /// @throws std::overflow_error when the encoded value does not fit in 64 bits.
+        static std::uint64_t decode_varint(const std::uint8_t* data, std::size_t available, std::size_t& count)
+        {
+            std::uint64_t raw{};
+
+            for (std::size_t i = 0; i < varint::max_size<std::uint64_t>; i++)
+            {
+                if (i >= available)
+                {
+                    throw std::out_of_range("not enough bytes to extract");
+                }
+
+                std::uint64_t group{data[i] & std::uint64_t{0x7F}};
+
+                // The tenth byte may only carry the most significant bit
+                if (i == (varint::max_size<std::uint64_t> - 1) && group > 1)
+                {
+                    throw std::overflow_error("varint does not fit in type");
+                }
+
+                raw |= group << (7 * i);
+
+                if (data[i] < 0x80)
+                {
+                    count = i + 1;
+
+                    return raw;
+                }
+            }
+
+            throw std::overflow_error("varint does not fit in type");
+        }
+
         /// @brief Check that a specific range is within bounds.
         ///
         /// @param[in] offset           Starting offset.
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <kouta/base/asio.hpp>
+#include <kouta/base/callback.hpp>
+#include <kouta/base/component.hpp>
+#include <kouta/io/frame-decoder.hpp>
+#include <kouta/io/gather-packer.hpp>
+#include <kouta/io/packer.hpp>
+#include <kouta/io/parser.hpp>
+
+namespace kouta::io
+{
+    /// @brief Component that exchanges frames over a byte stream.
+    ///
+    /// @details
+    /// The StreamComponent owns a stream (e.g. `asio::ip::tcp::socket`, `asio::local::stream_protocol::socket` or
+    /// `asio::serial_port`) that uses the event loop of its parent. Once started, a read operation is always kept in
+    /// flight directly into the buffer of a @ref FrameDecoder, and each decoded frame is delivered through a callback.
+    ///
+    /// Only one read operation is in flight at a time, as the completion order of concurrent reads on the same stream
+    /// is not guaranteed and frames must be reassembled from contiguous bytes. Each read requests at least the read
+    /// size, and all the frames it completes are delivered before the next one is issued.
+    ///
+    /// Outgoing frames are queued, and all the frames queued while a write operation is in flight are sent at once with
+    /// a single gather write (which includes the sequences referenced by each @ref GatherPacker).
+    ///
+    /// The component may be destroyed while operations are in flight: their completions are then discarded without
+    /// accessing it.
+    ///
+    /// The stream must be opened/connected through @ref stream() before calling @ref start().
+    ///
+    /// @note As any other component, the StreamComponent is **not thread-safe** and must only be used from within its
+    /// event loop.
+    ///
+    /// @tparam TStream             Type of the stream, which must be constructible from an I/O context and support
+    ///                             `async_read_some()` and `asio::async_write()`.
+    template<class TStream>
+    class StreamComponent : public base::Component
+    {
+    public:
+        /// Type of the underlying stream.
+        using Stream = TStream;
+        /// Callback to invoke for each received frame. The parser is only valid during the invocation.
+        using OnFrame = base::Callback<const Parser&>;
+        /// Callback to invoke when the stream fails (e.g. is closed by the peer).
+        using OnError = base::Callback<const base::asio::error_code&>;
+
+        /// Default number of bytes requested in each read operation.
+        static constexpr std::size_t DefaultReadSize{4096};
+
+        // Not default-constructible.
+        StreamComponent() = delete;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] parent           Parent component granting access to the event loop.
+        /// @param[in] framer           Framing function used to split the received bytes into frames.
+        /// @param[in] on_frame         Callback to invoke for each received frame.
+        /// @param[in] on_error         Callback to invoke when a read or write operation fails. Reading is stopped
+        ///                             after an error.
+        /// @param[in] read_size        Minimum number of bytes requested in each read operation.
+        StreamComponent(
+            base::Component* parent,
+            FrameDecoder::Framer framer,
+            OnFrame on_frame,
+            OnError on_error,
+            std::size_t read_size = DefaultReadSize)
+            : base::Component{parent}
+            , m_decoder{std::move(framer), read_size * 2}
+            , m_on_frame{std::move(on_frame)}
+            , m_on_error{std::move(on_error)}
+            , m_read_size{read_size}
+            , m_reading{false}
+            , m_read_in_flight{false}
+            , m_queued{}
+            , m_writing{}
+            , m_buffers{}
+            , m_alive{std::make_shared<bool>(true)}
+            , m_stream{context()}
+        {
+        }
+
+        // Not copyable
+        StreamComponent(const StreamComponent&) = delete;
+        StreamComponent& operator=(const StreamComponent&) = delete;
+
+        // Not movable
+        StreamComponent(StreamComponent&&) = delete;
+        StreamComponent& operator=(StreamComponent&&) = delete;
+
+        ~StreamComponent() override = default;
+
+        /// @brief Obtain a reference to the underlying stream (e.g. to open or connect it).
+        Stream& stream()
+        {
+            return m_stream;
+        }
+
+        /// @brief Start reading from the stream.
+        ///
+        /// @note This has no effect if the component is already reading.
+        void start()
+        {
+            if (!m_reading)
+            {
+                m_reading = true;
+
+                // Otherwise, reading resumes once the cancelled read completes
+                if (!m_read_in_flight)
+                {
+                    read();
+                }
+            }
+        }
+
+        /// @brief Close the stream, cancelling the pending operations and discarding the queued frames.
+        ///
+        /// @details
+        /// The buffers of the cancelled operations are kept alive until their completions arrive, as the operating
+        /// system (e.g. with the io_uring backend) may still access them. Hence, the buffered bytes and the frames of
+        /// the write operation in flight are only discarded at that point.
+        void close()
+        {
+            base::asio::error_code ec{};
+
+            m_stream.close(ec);
+            m_reading = false;
+            m_queued.clear();
+
+            if (!m_read_in_flight)
+            {
+                m_decoder.clear();
+            }
+        }
+
+        /// @brief Queue a frame to be sent.
+        ///
+        /// @details
+        /// If no write operation is in flight, the frame is sent right away. Otherwise, it is sent along with the rest
+        /// of the queued frames once the current operation completes.
+        ///
+        /// @param[in] packer           Packer containing the frame.
+        void send(Packer packer)
+        {
+            enqueue(std::move(packer));
+        }
+
+        /// @brief Queue a scatter/gather frame to be sent.
+        ///
+        /// @details
+        /// The referenced sequences are written along with the inline data, hence their memory must remain valid until
+        /// the frame has been sent (see @ref pending()).
+        ///
+        /// @param[in] packer           Packer containing the frame.
+        void send(GatherPacker packer)
+        {
+            enqueue(std::move(packer));
+        }
+
+        /// @brief Other packers derived from @ref Packer are not supported, as they would be sliced.
+        template<class TPacker>
+            requires(std::derived_from<std::remove_cvref_t<TPacker>, Packer>
+                     && !std::same_as<std::remove_cvref_t<TPacker>, Packer>
+                     && !std::same_as<std::remove_cvref_t<TPacker>, GatherPacker>)
+        void send(TPacker&& packer) = delete;
+
+        /// @brief Obtain the number of frames that have not been sent yet.
+        ///
+        /// @note This includes the frames of the write operation in flight.
+        std::size_t pending() const
+        {
+            return m_queued.size() + m_writing.size();
+        }
+
+    private:
+        /// @brief Frame queued to be sent.
+        using Frame = std::variant<Packer, GatherPacker>;
+
+        /// @brief Queue a frame, and send it right away if no write operation is in flight.
+        void enqueue(Frame frame)
+        {
+            m_queued.push_back(std::move(frame));
+
+            if (m_writing.empty())
+            {
+                write();
+            }
+        }
+
+        /// @brief Bind a completion handler to the executor of the component.
+        ///
+        /// @details
+        /// The handler is not invoked if the component has been destroyed by the time the operation completes.
+        auto guard(void (StreamComponent::*handler)(const base::asio::error_code&, std::size_t))
+        {
+            return base::asio::bind_executor(
+                executor(),
+                [this, handler, alive = std::weak_ptr<bool>{m_alive}](const base::asio::error_code& ec,
+                                                                       std::size_t count)
+                {
+                    if (!alive.expired())
+                    {
+                        (this->*handler)(ec, count);
+                    }
+                });
+        }
+
+        /// @brief Issue a read operation into the frame decoder.
+        void read()
+        {
+            auto region{m_decoder.prepare(m_read_size)};
+
+            m_read_in_flight = true;
+            m_stream.async_read_some(
+                base::asio::buffer(region.data(), region.size()),
+                guard(&StreamComponent::handle_read));
+        }
+
+        /// @brief Handle the completion of a read operation.
+        ///
+        /// @details
+        /// All the complete frames are delivered through the callback (as direct invocations) before the next read
+        /// operation is issued.
+        ///
+        /// @param[in] ec               Error code of the read operation.
+        /// @param[in] count            Number of bytes read.
+        void handle_read(const base::asio::error_code& ec, std::size_t count)
+        {
+            m_read_in_flight = false;
+
+            if (ec == base::asio::error::operation_aborted)
+            {
+                // The decoder was not cleared by close() while the read was in flight
+                m_decoder.clear();
+
+                if (m_reading)
+                {
+                    read();
+                }
+
+                return;
+            }
+
+            if (ec)
+            {
+                m_reading = false;
+                m_on_error(ec);
+                return;
+            }
+
+            m_decoder.commit(count);
+
+            try
+            {
+                while (auto frame{m_decoder.next()})
+                {
+                    m_on_frame(*frame);
+                }
+            }
+            catch (const std::length_error&)
+            {
+                // The stream cannot be resynchronized
+                close();
+                m_on_error(base::asio::error::message_size);
+                return;
+            }
+
+            if (m_reading)
+            {
+                read();
+            }
+        }
+
+        /// @brief Send all the queued frames with a single gather write.
+        void write()
+        {
+            m_writing.clear();
+            m_buffers.clear();
+
+            while (!m_queued.empty())
+            {
+                m_writing.push_back(std::move(m_queued.front()));
+                m_queued.pop_front();
+            }
+
+            for (auto& frame : m_writing)
+            {
+                if (auto* gather{std::get_if<GatherPacker>(&frame)})
+                {
+                    const auto& buffers{gather->buffers()};
+
+                    m_buffers.insert(m_buffers.end(), buffers.begin(), buffers.end());
+                }
+                else
+                {
+                    m_buffers.push_back(base::asio::buffer(std::get<Packer>(frame).data()));
+                }
+            }
+
+            base::asio::async_write(
+                m_stream,
+                m_buffers,
+                guard(&StreamComponent::handle_write));
+        }
+
+        /// @brief Handle the completion of a write operation.
+        ///
+        /// @details
+        /// Frames queued while the operation was in flight are sent right away. Cancellations are not reported as
+        /// errors.
+        ///
+        /// @param[in] ec               Error code of the write operation.
+        void handle_write(const base::asio::error_code& ec, std::size_t)
+        {
+            m_writing.clear();
+            m_buffers.clear();
+
+            if (ec && ec != base::asio::error::operation_aborted)
+            {
+                m_queued.clear();
+                m_on_error(ec);
+                return;
+            }
+
+            if (!m_queued.empty())
+            {
+                write();
+            }
+        }
+
+        FrameDecoder m_decoder;
+        OnFrame m_on_frame;
+        OnError m_on_error;
+        std::size_t m_read_size;
+        bool m_reading;
+        bool m_read_in_flight;
+        std::deque<Frame> m_queued;
+        std::vector<Frame> m_writing;
+        std::vector<base::asio::const_buffer> m_buffers;
+
+        // Expires when the component is destroyed, so that the completions of its operations are discarded
+        std::shared_ptr<bool> m_alive;
+
+        // Declared last, so that it is closed before the buffers of its operations are destroyed
+        Stream m_stream;
+    };
+}  // namespace kouta::io
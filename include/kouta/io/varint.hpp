@@ -0,0 +1,129 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace kouta::io::varint
+{
+    /// @brief Integral types that can be encoded as a variable-length integer.
+    ///
+    /// @details
+    /// `bool` is excluded, as it has no unsigned counterpart (nor any use for a variable-length encoding).
+    template<class TValue>
+    concept Integer = std::integral<TValue> && !std::same_as<std::remove_cv_t<TValue>, bool>;
+
+    /// @brief Maximum number of bytes a variable-length encoded value of type @p TValue may occupy.
+    ///
+    /// @details
+    /// Each byte of a variable-length integer (LEB128) carries 7 bits of the value, while the most significant bit
+    /// signals whether more bytes follow.
+    ///
+    /// @tparam TValue              Integral type to encode.
+    template<Integer TValue>
+    inline constexpr std::size_t max_size{(std::numeric_limits<std::make_unsigned_t<TValue>>::digits + 6) / 7};
+
+    /// @brief Map a signed value to an unsigned one so that values of small magnitude remain small.
+    ///
+    /// @details
+    /// ZigZag encoding interleaves positive and negative values (`0 -> 0`, `-1 -> 1`, `1 -> 2`, `-2 -> 3`...), so that
+    /// negative values do not always take the maximum number of bytes when encoded as a variable-length integer.
+    ///
+    /// @tparam TValue              Signed type to encode.
+    ///
+    /// @param[in] value            Value to encode.
+    ///
+    /// @returns Encoded value.
+    template<std::signed_integral TValue>
+    constexpr std::make_unsigned_t<TValue> zigzag_encode(TValue value)
+    {
+        using Unsigned = std::make_unsigned_t<TValue>;
+
+        return static_cast<Unsigned>(
+            (static_cast<Unsigned>(value) << 1) ^ static_cast<Unsigned>(value >> std::numeric_limits<TValue>::digits));
+    }
+
+    /// @brief Revert the mapping performed by @ref zigzag_encode().
+    ///
+    /// @tparam TValue              Unsigned type to decode.
+    ///
+    /// @param[in] value            Value to decode.
+    ///
+    /// @returns Decoded (signed) value.
+    template<std::unsigned_integral TValue>
+    constexpr std::make_signed_t<TValue> zigzag_decode(TValue value)
+    {
+        return static_cast<std::make_signed_t<TValue>>(static_cast<TValue>((value >> 1) ^ (~(value & 1) + 1)));
+    }
+
+    /// @brief Encode a value as a variable-length integer.
+    ///
+    /// @details
+    /// Signed values are ZigZag-encoded (see @ref zigzag_encode()) before being written.
+    ///
+    /// @tparam TValue              Integral type to encode.
+    ///
+    /// @param[in] value            Value to encode.
+    /// @param[out] out             Output buffer. Must have room for at least @ref max_size bytes.
+    ///
+    /// @returns Number of bytes written.
+    template<Integer TValue>
+    constexpr std::size_t encode(TValue value, std::uint8_t* out)
+    {
+        std::make_unsigned_t<TValue> raw{};
+
+        if constexpr (std::is_signed_v<TValue>)
+        {
+            raw = zigzag_encode(value);
+        }
+        else
+        {
+            raw = value;
+        }
+
+        std::size_t count{0};
+
+        while (raw >= 0x80)
+        {
+            out[count++] = static_cast<std::uint8_t>(raw | 0x80);
+            raw >>= 7;
+        }
+
+        out[count++] = static_cast<std::uint8_t>(raw);
+
+        return count;
+    }
+
+    /// @brief Obtain the number of bytes a value occupies when encoded as a variable-length integer.
+    ///
+    /// @tparam TValue              Integral type to encode.
+    ///
+    /// @param[in] value            Value to encode.
+    ///
+    /// @returns Number of bytes required.
+    template<Integer TValue>
+    constexpr std::size_t encoded_size(TValue value)
+    {
+        std::make_unsigned_t<TValue> raw{};
+
+        if constexpr (std::is_signed_v<TValue>)
+        {
+            raw = zigzag_encode(value);
+        }
+        else
+        {
+            raw = value;
+        }
+
+        std::size_t count{1};
+
+        while (raw >= 0x80)
+        {
+            raw >>= 7;
+            count++;
+        }
+
+        return count;
+    }
+}  // namespace kouta::io::varint
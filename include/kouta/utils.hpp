@@ -1,3 +1,6 @@
 #pragma once
 
+#include <kouta/utils/enum-dispatcher.hpp>
+#include <kouta/utils/enum-map.hpp>
+#include <kouta/utils/enum-reflection.hpp>
 #include <kouta/utils/enum-set.hpp>
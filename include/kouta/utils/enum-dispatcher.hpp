@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <kouta/utils/enum-set.hpp>
+
+namespace kouta::utils
+{
+    /// @brief Route of an @ref EnumDispatcher, binding an enumeration value to a member function.
+    ///
+    /// @tparam Key                 Enumeration value.
+    /// @tparam Method              Member function to invoke for said value.
+    template<auto Key, auto Method>
+        requires std::is_enum_v<decltype(Key)> && std::is_member_function_pointer_v<decltype(Method)>
+    struct Route
+    {
+    };
+
+    template<class TEnum, class TTarget, class TSignature, class... TRoutes>
+    class EnumDispatcher;
+
+    /// @brief Dispatcher that invokes a member function depending on an enumeration value.
+    ///
+    /// @details
+    /// The routes are given at compile time, and turned into a table of function pointers indexed by the positions of
+    /// the enumeration values (see @ref EnumSet for the requirements on the enumeration, which may be sparse). Hence,
+    /// dispatching is a single indexed indirect call, instead of a hash lookup followed by the call to a type-erased
+    /// handler.
+    ///
+    /// Routing the same value twice, or a value that does not correspond to any position (e.g. beyond the `_Total`
+    /// label), results in a compilation error.
+    ///
+    /// @example
+    /// ```c++
+    /// class Router
+    /// {
+    /// public:
+    ///     void handle_message(MessageType type, const io::Parser& parser)
+    ///     {
+    ///         Dispatcher::try_dispatch(*this, type, parser);
+    ///     }
+    ///
+    /// private:
+    ///     void handle_ping(const io::Parser& parser);
+    ///     void handle_data(const io::Parser& parser);
+    ///
+    ///     // Must be declared after the member functions
+    ///     using Dispatcher = EnumDispatcher<MessageType,
+    ///                                       Router,
+    ///                                       void(const io::Parser&),
+    ///                                       Route<MessageType::Ping, &Router::handle_ping>,
+    ///                                       Route<MessageType::Data, &Router::handle_data>>;
+    /// };
+    /// ```
+    ///
+    /// @tparam TEnum               Enumeration type to dispatch on.
+    /// @tparam TTarget             Class of the member functions.
+    /// @tparam TResult             Return type of the member functions.
+    /// @tparam TArgs               Arguments of the member functions.
+    /// @tparam Keys                Enumeration values of the routes.
+    /// @tparam Methods             Member functions of the routes.
+    template<class TEnum, class TTarget, class TResult, class... TArgs, auto... Keys, auto... Methods>
+        requires std::is_enum_v<TEnum>
+    class EnumDispatcher<TEnum, TTarget, TResult(TArgs...), Route<Keys, Methods>...>
+    {
+    public:
+        /// Enumeration type used.
+        using EnumType = TEnum;
+
+        /// Set of routed values.
+        using KeySet = EnumSet<TEnum>;
+
+        /// @brief Obtain the set of routed values.
+        static constexpr KeySet keys()
+        {
+            return KeySet{Keys...};
+        }
+
+        /// @brief Check whether a value is routed.
+        static constexpr bool contains(TEnum key)
+        {
+            return index(key) < KeySet::Size && Table[index(key)] != nullptr;
+        }
+
+        /// @brief Invoke the member function routed for a value.
+        ///
+        /// @param[in] target           Object on which to invoke the member function.
+        /// @param[in] key              Value to dispatch.
+        /// @param[in] args             Arguments to forward to the member function.
+        ///
+        /// @returns Result of the member function.
+        ///
+        /// @throws std::out_of_range if the value is not routed.
+        template<class... TCallArgs>
+        static TResult dispatch(TTarget& target, TEnum key, TCallArgs&&... args)
+        {
+            if (!contains(key))
+            {
+                throw std::out_of_range("EnumDispatcher key not routed");
+            }
+
+            return Table[index(key)](target, std::forward<TCallArgs>(args)...);
+        }
+
+        /// @brief Invoke the member function routed for a value, if any.
+        ///
+        /// @param[in] target           Object on which to invoke the member function.
+        /// @param[in] key              Value to dispatch.
+        /// @param[in] args             Arguments to forward to the member function.
+        ///
+        /// @returns Whether the value was routed.
+        template<class... TCallArgs>
+            requires std::is_void_v<TResult>
+        static bool try_dispatch(TTarget& target, TEnum key, TCallArgs&&... args)
+        {
+            if (!contains(key))
+            {
+                return false;
+            }
+
+            Table[index(key)](target, std::forward<TCallArgs>(args)...);
+
+            return true;
+        }
+
+    private:
+        /// Type of the entries of the table.
+        using Thunk = TResult (*)(TTarget&, TArgs...);
+
+        /// @brief Convert a value to an index in the table.
+        static constexpr std::size_t index(TEnum key)
+        {
+            return KeySet::Traits::index(key);
+        }
+
+        /// @brief Invoke a member function.
+        template<auto Method>
+        static TResult invoke(TTarget& target, TArgs... args)
+        {
+            return (target.*Method)(std::forward<TArgs>(args)...);
+        }
+
+        /// @brief Generate the table of routes.
+        ///
+        /// @note Throwing results in a compilation error, as the table is generated at compile time.
+        static consteval std::array<Thunk, KeySet::Size> make_table()
+        {
+            std::array<Thunk, KeySet::Size> table{};
+            std::array<std::size_t, sizeof...(Keys)> keys{index(Keys)...};
+            std::array<Thunk, sizeof...(Methods)> thunks{&invoke<Methods>...};
+
+            for (std::size_t i = 0; i < keys.size(); i++)
+            {
+                if (keys[i] >= table.size())
+                {
+                    throw std::out_of_range("route key out of range");
+                }
+
+                if (table[keys[i]] != nullptr)
+                {
+                    throw std::invalid_argument("duplicate route key");
+                }
+
+                table[keys[i]] = thunks[i];
+            }
+
+            return table;
+        }
+
+        static constexpr std::array<Thunk, KeySet::Size> Table{make_table()};
+    };
+}  // namespace kouta::utils
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <kouta/utils/enum-set.hpp>
+
+namespace kouta::utils
+{
+    /// @brief Map that uses enumeration values as keys.
+    ///
+    /// @details
+    /// The values are stored in a dense array indexed by the positions of the enumeration values (see @ref EnumSet for
+    /// the requirements on the enumeration, which may be sparse), and an @ref EnumSet keeps track of the keys that are
+    /// present. Hence, lookups are a single indexed access and iterating over the map only visits the keys that are
+    /// present.
+    ///
+    /// Values of keys that are not present are default-constructed, and reset to said state when erased.
+    ///
+    /// @example
+    /// ```c++
+    /// EnumMap<MyEnum, std::string> names{{MyEnum::A, "a"}, {MyEnum::C, "c"}};
+    ///
+    /// names[MyEnum::B] = "b";
+    /// names.erase(MyEnum::A);
+    ///
+    /// names.for_each(
+    ///     [](MyEnum key, const std::string& value)
+    ///     {
+    ///     });
+    /// ```
+    ///
+    /// @tparam TEnum               Enumeration type to use as key.
+    /// @tparam TValue              Type of the values (must be default-constructible).
+    template<class TEnum, class TValue>
+        requires std::is_enum_v<TEnum> && std::is_default_constructible_v<TValue>
+    class EnumMap
+    {
+    public:
+        /// Enumeration type used.
+        using EnumType = TEnum;
+
+        /// Type of the values.
+        using ValueType = TValue;
+
+        /// Set of keys.
+        using KeySet = EnumSet<TEnum>;
+
+        /// Maximum number of values in the map.
+        static constexpr std::size_t Capacity{KeySet::Size};
+
+        /// @brief Default constructor.
+        constexpr EnumMap() = default;
+
+        /// @brief Constructor from a set of key-value pairs.
+        ///
+        /// @param[in] values           Values to insert.
+        constexpr EnumMap(std::initializer_list<std::pair<TEnum, TValue>> values)
+            : EnumMap{}
+        {
+            for (const auto& [key, value] : values)
+            {
+                insert_or_assign(key, value);
+            }
+        }
+
+        /// @brief Obtain the number of values in the map.
+        constexpr std::size_t size() const
+        {
+            return m_keys.count();
+        }
+
+        /// @brief Check whether the map is empty.
+        constexpr bool empty() const
+        {
+            return m_keys.none();
+        }
+
+        /// @brief Obtain the set of keys present in the map.
+        constexpr const KeySet& keys() const
+        {
+            return m_keys;
+        }
+
+        /// @brief Check whether a key is present in the map.
+        constexpr bool contains(TEnum key) const
+        {
+            return index(key) < Capacity && m_keys[key];
+        }
+
+        /// @brief Access the value of a key, inserting a default-constructed one if it is not present.
+        ///
+        /// @note Does not perform any bound checking.
+        constexpr TValue& operator[](TEnum key)
+        {
+            m_keys[key] = true;
+
+            return m_values[index(key)];
+        }
+
+        /// @brief Access the value of a key.
+        ///
+        /// @throws std::out_of_range if the key is not present in the map.
+        /// @{
+        constexpr TValue& at(TEnum key)
+        {
+            check_present(key);
+
+            return m_values[index(key)];
+        }
+
+        constexpr const TValue& at(TEnum key) const
+        {
+            check_present(key);
+
+            return m_values[index(key)];
+        }
+        /// @}
+
+        /// @brief Obtain a pointer to the value of a key.
+        ///
+        /// @returns Pointer to the value, or `nullptr` if the key is not present in the map.
+        /// @{
+        constexpr TValue* find(TEnum key)
+        {
+            return contains(key) ? &m_values[index(key)] : nullptr;
+        }
+
+        constexpr const TValue* find(TEnum key) const
+        {
+            return contains(key) ? &m_values[index(key)] : nullptr;
+        }
+        /// @}
+
+        /// @brief Insert or replace the value of a key.
+        ///
+        /// @param[in] key              Key to insert.
+        /// @param[in] value            Value to store.
+        ///
+        /// @returns Reference to the stored value.
+        ///
+        /// @throws std::out_of_range if the key is not within the enumeration.
+        template<class T>
+        constexpr TValue& insert_or_assign(TEnum key, T&& value)
+        {
+            m_keys.set(key);
+
+            return m_values[index(key)] = std::forward<T>(value);
+        }
+
+        /// @brief Remove a key from the map.
+        ///
+        /// @returns Whether the key was present.
+        constexpr bool erase(TEnum key)
+        {
+            if (!contains(key))
+            {
+                return false;
+            }
+
+            m_keys.reset(key);
+            m_values[index(key)] = TValue{};
+
+            return true;
+        }
+
+        /// @brief Remove all the keys from the map.
+        constexpr void clear()
+        {
+            for (auto key : m_keys)
+            {
+                m_values[index(key)] = TValue{};
+            }
+
+            m_keys.reset();
+        }
+
+        /// @brief Invoke a function for each key present in the map, in ascending order.
+        ///
+        /// @param[in] function         Function taking the key and a reference to its value.
+        /// @{
+        template<class TFunction>
+        constexpr void for_each(TFunction&& function)
+        {
+            for (auto key : m_keys)
+            {
+                function(key, m_values[index(key)]);
+            }
+        }
+
+        template<class TFunction>
+        constexpr void for_each(TFunction&& function) const
+        {
+            for (auto key : m_keys)
+            {
+                function(key, m_values[index(key)]);
+            }
+        }
+        /// @}
+
+    private:
+        /// @brief Convert a key to an index in the array.
+        static constexpr std::size_t index(TEnum key)
+        {
+            return KeySet::Traits::index(key);
+        }
+
+        /// @brief Check that a key is present.
+        ///
+        /// @throws std::out_of_range if the key is not present in the map.
+        constexpr void check_present(TEnum key) const
+        {
+            if (!contains(key))
+            {
+                throw std::out_of_range("EnumMap key not present");
+            }
+        }
+
+        KeySet m_keys{};
+        std::array<TValue, Capacity> m_values{};
+    };
+}  // namespace kouta::utils
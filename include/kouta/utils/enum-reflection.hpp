@@ -0,0 +1,316 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace kouta::utils
+{
+    /// @brief Range of underlying values inspected when reflecting an enumeration.
+    ///
+    /// @details
+    /// Enumerations lacking a `_Total` label are reflected by checking, at compile time, which values within this
+    /// range correspond to a label. The range may be customized for a specific enumeration by specializing this
+    /// template. It is always clamped to the range of the underlying type.
+    ///
+    /// @example
+    /// ```c++
+    /// template<>
+    /// struct kouta::utils::EnumRange<MyEnum>
+    /// {
+    ///     static constexpr long long Min{-16};
+    ///     static constexpr long long Max{1024};
+    /// };
+    /// ```
+    ///
+    /// @tparam TEnum               Enumeration type.
+    template<class TEnum>
+    struct EnumRange
+    {
+        /// Lowest value to inspect.
+        static constexpr long long Min{0};
+        /// Highest value to inspect (inclusive).
+        static constexpr long long Max{255};
+    };
+
+    namespace detail
+    {
+        /// @brief Obtain the name of an enumeration value from the signature of this function.
+        ///
+        /// @returns Name of the label (without qualifiers), or an empty string if @p Value does not correspond to any.
+        template<class TEnum, TEnum Value>
+        consteval std::string_view enum_name()
+        {
+#if defined(__clang__) || defined(__GNUC__)
+            // e.g. "... [with TEnum = ns::Color; TEnum Value = ns::Color::Red; ...]" or "... [TEnum = ns::Color, Value
+            // = ns::Color::Red]". Values without a label are printed as a cast, e.g. "(ns::Color)5"
+            std::string_view signature{__PRETTY_FUNCTION__};
+            auto start{signature.rfind("Value = ")};
+
+            if (start == std::string_view::npos)
+            {
+                return {};
+            }
+
+            start += 8;
+
+            auto name{signature.substr(start, signature.find_first_of(";]", start) - start)};
+#elif defined(_MSC_VER)
+            // e.g. "... enum_name<enum ns::Color,ns::Color::Red>(void)". Values without a label are printed as numbers
+            std::string_view signature{__FUNCSIG__};
+            auto end{signature.rfind(">(void)")};
+            auto start{signature.rfind(',', end) + 1};
+            auto name{signature.substr(start, end - start)};
+#else
+#error "Enumeration reflection is not supported by this compiler"
+#endif
+            if (name.empty() || name[0] == '(' || name[0] == '-' || (name[0] >= '0' && name[0] <= '9'))
+            {
+                return {};
+            }
+
+            if (auto qualifier{name.rfind("::")}; qualifier != std::string_view::npos)
+            {
+                name.remove_prefix(qualifier + 2);
+            }
+
+            return name;
+        }
+
+        /// @brief Check whether an enumeration has a `_Total` label.
+        template<class TEnum>
+        concept HasTotal = requires { TEnum::_Total; };
+
+        /// @brief Reflected labels of an enumeration within a range of underlying values.
+        ///
+        /// @tparam TEnum           Enumeration type.
+        /// @tparam Min             Lowest underlying value.
+        /// @tparam Size            Number of underlying values in the range.
+        template<class TEnum, long long Min, std::size_t Size>
+        struct EnumLabels
+        {
+            /// @brief Obtain the names of all the values in the range.
+            template<std::size_t... I>
+            static consteval std::array<std::string_view, Size> make_names(std::index_sequence<I...>)
+            {
+                return {enum_name<TEnum, static_cast<TEnum>(Min + static_cast<long long>(I))>()...};
+            }
+
+            /// Names of all the values in the range (empty if the value has no label).
+            static constexpr std::array<std::string_view, Size> RangeNames{
+                make_names(std::make_index_sequence<Size>{})};
+
+            /// @brief Count the values with a label.
+            static consteval std::size_t make_count()
+            {
+                std::size_t count{0};
+
+                for (auto name : RangeNames)
+                {
+                    count += name.empty() ? 0 : 1;
+                }
+
+                return count;
+            }
+
+            /// Number of values with a label.
+            static constexpr std::size_t Count{make_count()};
+
+            /// @brief Obtain the dense index of each value in the range (@ref Count if the value has no label).
+            static consteval std::array<std::size_t, Size> make_indices()
+            {
+                std::array<std::size_t, Size> indices{};
+                std::size_t index{0};
+
+                for (std::size_t i = 0; i < Size; i++)
+                {
+                    indices[i] = RangeNames[i].empty() ? Count : index++;
+                }
+
+                return indices;
+            }
+
+            /// Dense index of each value in the range.
+            static constexpr std::array<std::size_t, Size> Indices{make_indices()};
+
+            /// @brief Obtain the values with a label, in ascending order.
+            static consteval std::array<TEnum, Count> make_values()
+            {
+                std::array<TEnum, Count> values{};
+
+                for (std::size_t i = 0; i < Size; i++)
+                {
+                    if (Indices[i] < Count)
+                    {
+                        values[Indices[i]] = static_cast<TEnum>(Min + static_cast<long long>(i));
+                    }
+                }
+
+                return values;
+            }
+
+            /// Values with a label, in ascending order.
+            static constexpr std::array<TEnum, Count> Values{make_values()};
+        };
+    }  // namespace detail
+
+    /// @brief Compile-time information about an enumeration.
+    ///
+    /// @details
+    /// Enumerations are mapped to dense indices in the `[0, Count)` range, which allows using them as indices of
+    /// compact containers (see @ref EnumSet, @ref EnumMap or @ref EnumDispatcher):
+    ///
+    /// - Enumerations with a `_Total` label are expected to have contiguous values starting at 0, hence their values
+    ///   are used as indices and `Count` is given by said label.
+    /// - Otherwise, the labels of the enumeration are reflected at compile time within the @ref EnumRange (parsing
+    ///   the signature of a function template instantiated for each value), so that sparse enumerations (e.g.
+    ///   `0x01, 0x10, 0x81`) get consecutive indices. Mapping a value to its index is a lookup in a constant table.
+    ///
+    /// @tparam TEnum               Enumeration type.
+    template<class TEnum>
+        requires std::is_enum_v<TEnum>
+    class EnumTraits
+    {
+    public:
+        /// Underlying type of the enumeration.
+        using Underlying = std::underlying_type_t<TEnum>;
+
+        /// Whether the enumeration has a `_Total` label.
+        static constexpr bool Dense{detail::HasTotal<TEnum>};
+
+    private:
+        /// @brief Obtain the lowest underlying value to reflect.
+        static consteval long long range_min()
+        {
+            if constexpr (Dense)
+            {
+                return 0;
+            }
+            else
+            {
+                return std::cmp_less(EnumRange<TEnum>::Min, std::numeric_limits<Underlying>::min())
+                           ? static_cast<long long>(std::numeric_limits<Underlying>::min())
+                           : EnumRange<TEnum>::Min;
+            }
+        }
+
+        /// @brief Obtain the highest underlying value to reflect.
+        static consteval long long range_max()
+        {
+            if constexpr (Dense)
+            {
+                return static_cast<long long>(TEnum::_Total) - 1;
+            }
+            else
+            {
+                return std::cmp_greater(EnumRange<TEnum>::Max, std::numeric_limits<Underlying>::max())
+                           ? static_cast<long long>(std::numeric_limits<Underlying>::max())
+                           : EnumRange<TEnum>::Max;
+            }
+        }
+
+        /// Lowest underlying value reflected.
+        static constexpr long long Min{range_min()};
+
+        /// Number of underlying values reflected.
+        static constexpr std::size_t RangeSize{static_cast<std::size_t>(range_max() - Min + 1)};
+
+        /// Reflected labels.
+        using Labels = detail::EnumLabels<TEnum, Min, RangeSize>;
+
+        /// @brief Obtain the number of values.
+        static consteval std::size_t count()
+        {
+            if constexpr (Dense)
+            {
+                return static_cast<std::size_t>(TEnum::_Total);
+            }
+            else
+            {
+                return Labels::Count;
+            }
+        }
+
+    public:
+        /// Number of values (i.e. number of dense indices).
+        static constexpr std::size_t Count{count()};
+
+        /// @brief Obtain the dense index of a value.
+        ///
+        /// @returns Index of the value, or @ref Count if it does not correspond to any label.
+        static constexpr std::size_t index(TEnum value)
+        {
+            auto raw{static_cast<Underlying>(value)};
+
+            if constexpr (Dense)
+            {
+                return std::cmp_less(raw, 0) || std::cmp_greater_equal(raw, Count) ? Count
+                                                                                      : static_cast<std::size_t>(raw);
+            }
+            else
+            {
+                if (std::cmp_less(raw, Min) || std::cmp_greater_equal(raw, Min + static_cast<long long>(RangeSize)))
+                {
+                    return Count;
+                }
+
+                return Labels::Indices[static_cast<std::size_t>(static_cast<long long>(raw) - Min)];
+            }
+        }
+
+        /// @brief Obtain the value corresponding to a dense index.
+        ///
+        /// @note Does not perform any bound checking.
+        static constexpr TEnum value(std::size_t index)
+        {
+            if constexpr (Dense)
+            {
+                return static_cast<TEnum>(index);
+            }
+            else
+            {
+                return Labels::Values[index];
+            }
+        }
+
+        /// @brief Obtain the name of a value.
+        ///
+        /// @returns Name of the label (without qualifiers), or an empty string if the value has no label.
+        static constexpr std::string_view name(TEnum value)
+        {
+            auto raw{static_cast<Underlying>(value)};
+
+            if (std::cmp_less(raw, Min) || std::cmp_greater_equal(raw, Min + static_cast<long long>(RangeSize)))
+            {
+                return {};
+            }
+
+            return Labels::RangeNames[static_cast<std::size_t>(static_cast<long long>(raw) - Min)];
+        }
+
+        /// @brief Obtain the value corresponding to a name.
+        ///
+        /// @returns Value of the label, or `std::nullopt` if there is no such label.
+        static constexpr std::optional<TEnum> from_name(std::string_view name)
+        {
+            if (name.empty())
+            {
+                return std::nullopt;
+            }
+
+            for (std::size_t i = 0; i < RangeSize; i++)
+            {
+                if (Labels::RangeNames[i] == name)
+                {
+                    return static_cast<TEnum>(Min + static_cast<long long>(i));
+                }
+            }
+
+            return std::nullopt;
+        }
+    };
+}  // namespace kouta::utils
@@ -1,22 +1,50 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <bit>
 #include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 
+#include <kouta/utils/enum-reflection.hpp>
+
 namespace kouta::utils
 {
+    template<class TEnum>
+        requires std::is_enum_v<TEnum>
+    class AtomicEnumSet;
+
     /// @brief Custom bitset implementation that allows using enumeration values as indices.
     ///
     /// @details
-    /// The used enumeration type used must:
+    /// The enumeration values are mapped to bit positions through @ref EnumTraits, hence the enumeration may either:
     ///
-    /// - Derive from std::size_t
-    /// - Not set any value for the labels (optionally, value 0 can be set for the first one)
-    /// - Contain a `_Total` label at the end
+    /// - Not set any value for the labels (optionally, value 0 can be set for the first one) and contain a `_Total`
+    ///   label at the end, which determines the number of values in the enumeration. Values are used as positions.
+    /// - Have arbitrary values within its @ref EnumRange (e.g. sparse protocol identifiers), in which case the labels
+    ///   are reflected at compile time and each one is assigned a consecutive position, so that the set only takes
+    ///   as many bits as there are labels.
     ///
-    /// The `_Total` label is used to determine the number of values in the enumeration (by explicitly casting it to an
-    /// std::size_t value).
+    /// Raw indices given to the API refer to said positions rather than to the underlying values.
+    ///
+    /// The bits are stored in 64-bit words, so that the whole API (including set operations) is usable in `constexpr`
+    /// contexts and works on a word at a time. Iterating over the set yields the enumeration values that are set, and
+    /// skips unset bits by counting trailing zeros, hence walking a sparse set is proportional to its @ref count().
+    ///
+    /// The API of `std::bitset` (which the set used to derive from) is kept, and the set converts explicitly to its
+    /// @ref BaseType (e.g. to be passed to functions taking a `const std::bitset&`). Conversions from integers are
+    /// explicit as well, so that sets are not mixed up with integers or sets of other enumerations by accident.
     ///
     /// @example
     /// ```c++
@@ -33,38 +61,187 @@ namespace kouta::utils
     ///
     /// // Test and set using enumeration values
     /// set.test(MyEnum::A);
-    /// set.set{MyEnum::B};
+    /// set.set(MyEnum::B);
     ///
     /// // Or raw indices
     /// set.test(0);
     /// set.set(1);
+    ///
+    /// // Iterate over the values that are set
+    /// for (MyEnum value : set)
+    /// {
+    /// }
     /// ```
     ///
     /// @tparam TEnum               Enumeration type to use.
     template<class TEnum>
         requires std::is_enum_v<TEnum>
-    class EnumSet : public std::bitset<static_cast<std::size_t>(TEnum::_Total)>
+    class EnumSet
     {
     public:
         /// Enumeration type used.
         using EnumType = TEnum;
 
-        /// Base biset type.
-        using BaseType = std::bitset<static_cast<std::size_t>(TEnum::_Total)>;
+        /// Traits mapping the enumeration values to bit positions.
+        using Traits = EnumTraits<TEnum>;
+
+        /// Type of the words holding the bits.
+        using Word = std::uint64_t;
+
+        /// Number of bits in the set.
+        static constexpr std::size_t Size{Traits::Count};
+
+        /// Equivalent bitset type.
+        using BaseType = std::bitset<Size>;
+
+        /// Number of bits in each word.
+        static constexpr std::size_t WordBits{64};
+
+        /// Number of words holding the bits.
+        static constexpr std::size_t Words{(Size + WordBits - 1) / WordBits};
+
+        /// @brief Proxy to a specific bit, returned by the non-const @ref operator[]().
+        class reference
+        {
+        public:
+            constexpr reference& operator=(bool value)
+            {
+                m_set->set(m_pos, value);
+
+                return *this;
+            }
+
+            constexpr reference& operator=(const reference& other)
+            {
+                return *this = static_cast<bool>(other);
+            }
+
+            constexpr operator bool() const
+            {
+                return m_set->test_unchecked(m_pos);
+            }
+
+            constexpr bool operator~() const
+            {
+                return !static_cast<bool>(*this);
+            }
+
+            constexpr reference& flip()
+            {
+                m_set->flip(m_pos);
+
+                return *this;
+            }
+
+        private:
+            friend class EnumSet;
+
+            constexpr reference(EnumSet* set, std::size_t pos)
+                : m_set{set}
+                , m_pos{pos}
+            {
+            }
+
+            EnumSet* m_set;
+            std::size_t m_pos;
+        };
+
+        /// @brief Iterator over the values that are set.
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = TEnum;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = TEnum;
+
+            constexpr Iterator() = default;
+
+            constexpr TEnum operator*() const
+            {
+                return Traits::value(m_index * WordBits + static_cast<std::size_t>(std::countr_zero(m_word)));
+            }
+
+            constexpr Iterator& operator++()
+            {
+                // Clear the lowest bit and move on to the next non-empty word if required
+                m_word &= m_word - 1;
+                advance();
+
+                return *this;
+            }
+
+            constexpr Iterator operator++(int)
+            {
+                Iterator previous{*this};
+
+                ++(*this);
+
+                return previous;
+            }
+
+            constexpr bool operator==(const Iterator& other) const
+            {
+                return m_index == other.m_index && m_word == other.m_word;
+            }
+
+        private:
+            friend class EnumSet;
 
-        using reference = BaseType::reference;
+            constexpr Iterator(const EnumSet* set, std::size_t index)
+                : m_set{set}
+                , m_index{index}
+                , m_word{index < Words ? set->m_words[index] : 0}
+            {
+                advance();
+            }
+
+            /// @brief Skip empty words.
+            constexpr void advance()
+            {
+                while (m_word == 0 && m_index < Words)
+                {
+                    m_index++;
+                    m_word = (m_index < Words) ? m_set->m_words[m_index] : 0;
+                }
+            }
+
+            const EnumSet* m_set{nullptr};
+            std::size_t m_index{Words};
+            Word m_word{0};
+        };
+
+        /// @brief Default constructor.
+        ///
+        /// @details
+        /// All the bits are unset.
+        constexpr EnumSet()
+            : m_words{}
+        {
+        }
 
-        // Re-export some methods
-        using BaseType::BaseType;
-        using BaseType::operator[];
-        using BaseType::set;
-        using BaseType::test;
+        /// @brief Constructor from an integral value.
+        ///
+        /// @details
+        /// The bits of the set are initialized from the bits of @p value (bits beyond @ref size() are ignored).
+        ///
+        /// @param[in] value            Value to initialize the bits from.
+        explicit constexpr EnumSet(unsigned long long value)
+            : m_words{}
+        {
+            if constexpr (Words > 0)
+            {
+                m_words[0] = static_cast<Word>(value);
+                trim();
+            }
+        }
 
         /// @brief Constructor from a set of values.
         ///
         /// @param[in] values           Values to set.
-        EnumSet(std::initializer_list<TEnum> values)
-            : BaseType{}
+        constexpr EnumSet(std::initializer_list<TEnum> values)
+            : m_words{}
         {
             for (auto v : values)
             {
@@ -72,30 +249,110 @@ namespace kouta::utils
             }
         }
 
+        /// @brief Constructor from the equivalent bitset.
+        ///
+        /// @param[in] bits             Bitset to initialize the bits from.
+        explicit EnumSet(const BaseType& bits)
+            : m_words{}
+        {
+            for (std::size_t pos = 0; pos < Size; pos++)
+            {
+                if (bits.test(pos))
+                {
+                    m_words[pos / WordBits] |= mask(pos);
+                }
+            }
+        }
+
+        /// @brief Obtain the number of bits in the set.
+        constexpr std::size_t size() const
+        {
+            return Size;
+        }
+
+        /// @brief Obtain the number of bits that are set.
+        constexpr std::size_t count() const
+        {
+            std::size_t total{0};
+
+            for (auto word : m_words)
+            {
+                total += static_cast<std::size_t>(std::popcount(word));
+            }
+
+            return total;
+        }
+
+        /// @brief Check whether all the bits are set.
+        constexpr bool all() const
+        {
+            return count() == Size;
+        }
+
+        /// @brief Check whether any bit is set.
+        constexpr bool any() const
+        {
+            for (auto word : m_words)
+            {
+                if (word != 0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// @brief Check whether no bit is set.
+        constexpr bool none() const
+        {
+            return !any();
+        }
+
         /// @brief Access a specific bit.
         ///
-        /// @note Does not perform any bound checking.
+        /// @pre @p pos is a valid position (or value) of the set, which is only checked (through `assert()`) in debug
+        /// builds. See @ref test() for a checked access.
         ///
         /// @param[in] pos          Position to check.
         ///
         /// @return Value of the bit.
-        bool operator[](EnumType pos) const
+        /// @{
+        constexpr bool operator[](std::size_t pos) const
         {
-            return BaseType::operator[](static_cast<std::size_t>(pos));
+            assert(pos < Size && "EnumSet position out of range");
+
+            return test_unchecked(pos);
         }
 
+        constexpr bool operator[](EnumType pos) const
+        {
+            return (*this)[to_index(pos)];
+        }
+        /// @}
+
         /// @brief Access a specific bit.
         ///
-        /// @note Does not perform any bound checking.
+        /// @pre @p pos is a valid position (or value) of the set, which is only checked (through `assert()`) in debug
+        /// builds.
         ///
         /// @param[in] pos          Position to check.
         ///
         /// @return Reference to the bit.
-        reference operator[](EnumType pos)
+        /// @{
+        constexpr reference operator[](std::size_t pos)
         {
-            return BaseType::operator[](static_cast<std::size_t>(pos));
+            assert(pos < Size && "EnumSet position out of range");
+
+            return reference{this, pos};
         }
 
+        constexpr reference operator[](EnumType pos)
+        {
+            return (*this)[to_index(pos)];
+        }
+        /// @}
+
         /// @brief Access a specific bit.
         ///
         /// @param[in] pos          Position to check.
@@ -103,9 +360,33 @@ namespace kouta::utils
         /// @return Value of the bit.
         ///
         /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
-        bool test(EnumType pos) const
+        /// @{
+        constexpr bool test(std::size_t pos) const
         {
-            return test(static_cast<std::size_t>(pos));
+            check_bounds(pos);
+
+            return test_unchecked(pos);
+        }
+
+        constexpr bool test(EnumType pos) const
+        {
+            return test(to_index(pos));
+        }
+        /// @}
+
+        /// @brief Set all the bits.
+        ///
+        /// @return Reference to this object for chaining
+        constexpr EnumSet& set()
+        {
+            for (auto& word : m_words)
+            {
+                word = ~Word{0};
+            }
+
+            trim();
+
+            return *this;
         }
 
         /// @brief Set the value of a specific bit.
@@ -116,11 +397,618 @@ namespace kouta::utils
         /// @return Reference to this object for chaining
         ///
         /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
-        EnumSet& set(EnumType pos, bool value = true)
+        /// @{
+        constexpr EnumSet& set(std::size_t pos, bool value = true)
+        {
+            check_bounds(pos);
+
+            if (value)
+            {
+                m_words[pos / WordBits] |= mask(pos);
+            }
+            else
+            {
+                m_words[pos / WordBits] &= ~mask(pos);
+            }
+
+            return *this;
+        }
+
+        constexpr EnumSet& set(EnumType pos, bool value = true)
+        {
+            return set(to_index(pos), value);
+        }
+        /// @}
+
+        /// @brief Unset all the bits.
+        ///
+        /// @return Reference to this object for chaining
+        constexpr EnumSet& reset()
+        {
+            for (auto& word : m_words)
+            {
+                word = 0;
+            }
+
+            return *this;
+        }
+
+        /// @brief Unset a specific bit.
+        ///
+        /// @param[in] pos          Position to unset.
+        ///
+        /// @return Reference to this object for chaining
+        ///
+        /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
+        /// @{
+        constexpr EnumSet& reset(std::size_t pos)
+        {
+            return set(pos, false);
+        }
+
+        constexpr EnumSet& reset(EnumType pos)
+        {
+            return set(to_index(pos), false);
+        }
+        /// @}
+
+        /// @brief Flip all the bits.
+        ///
+        /// @return Reference to this object for chaining
+        constexpr EnumSet& flip()
+        {
+            for (auto& word : m_words)
+            {
+                word = ~word;
+            }
+
+            trim();
+
+            return *this;
+        }
+
+        /// @brief Flip a specific bit.
+        ///
+        /// @param[in] pos          Position to flip.
+        ///
+        /// @return Reference to this object for chaining
+        ///
+        /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
+        /// @{
+        constexpr EnumSet& flip(std::size_t pos)
+        {
+            check_bounds(pos);
+
+            m_words[pos / WordBits] ^= mask(pos);
+
+            return *this;
+        }
+
+        constexpr EnumSet& flip(EnumType pos)
+        {
+            return flip(to_index(pos));
+        }
+        /// @}
+
+        /// @brief Check whether all the bits set in this set are also set in @p other.
+        constexpr bool is_subset_of(const EnumSet& other) const
+        {
+            for (std::size_t i = 0; i < Words; i++)
+            {
+                if ((m_words[i] & ~other.m_words[i]) != 0)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// @brief Check whether all the bits set in @p other are also set in this set.
+        constexpr bool is_superset_of(const EnumSet& other) const
+        {
+            return other.is_subset_of(*this);
+        }
+
+        /// @brief Check whether any bit is set in both this set and @p other.
+        constexpr bool intersects(const EnumSet& other) const
+        {
+            for (std::size_t i = 0; i < Words; i++)
+            {
+                if ((m_words[i] & other.m_words[i]) != 0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// @brief Obtain the value of the bits as an integer.
+        ///
+        /// @throws std::overflow_error if any bit beyond the 64th is set.
+        constexpr unsigned long long to_ullong() const
+        {
+            for (std::size_t i = 1; i < Words; i++)
+            {
+                if (m_words[i] != 0)
+                {
+                    throw std::overflow_error("EnumSet does not fit in an unsigned long long");
+                }
+            }
+
+            return (Words > 0) ? m_words[0] : 0;
+        }
+
+        /// @brief Obtain the value of the bits as an integer.
+        ///
+        /// @throws std::overflow_error if any bit beyond those of an unsigned long is set.
+        constexpr unsigned long to_ulong() const
+        {
+            auto value{to_ullong()};
+
+            if (value > std::numeric_limits<unsigned long>::max())
+            {
+                throw std::overflow_error("EnumSet does not fit in an unsigned long");
+            }
+
+            return static_cast<unsigned long>(value);
+        }
+
+        /// @brief Obtain the equivalent bitset.
+        explicit operator BaseType() const
+        {
+            BaseType result{};
+
+            for (auto value : *this)
+            {
+                result.set(to_index(value));
+            }
+
+            return result;
+        }
+
+        /// @brief Obtain a string representation of the bits (most significant first).
+        std::string to_string(char zero = '0', char one = '1') const
+        {
+            std::string result(Size, zero);
+
+            for (auto value : *this)
+            {
+                result[Size - 1 - to_index(value)] = one;
+            }
+
+            return result;
+        }
+
+        /// @brief Obtain a word of the underlying storage.
+        ///
+        /// @param[in] index        Index of the word, lower than @ref Words.
+        constexpr Word word(std::size_t index) const
+        {
+            return m_words[index];
+        }
+
+        /// @brief Obtain an iterator to the first value that is set.
+        constexpr Iterator begin() const
+        {
+            return Iterator{this, 0};
+        }
+
+        /// @brief Obtain an iterator past the last value that is set.
+        constexpr Iterator end() const
+        {
+            return Iterator{};
+        }
+
+        /// @brief Set operations (union, intersection, symmetric difference and difference).
+        /// @{
+        constexpr EnumSet& operator|=(const EnumSet& other)
+        {
+            for (std::size_t i = 0; i < Words; i++)
+            {
+                m_words[i] |= other.m_words[i];
+            }
+
+            return *this;
+        }
+
+        constexpr EnumSet& operator&=(const EnumSet& other)
+        {
+            for (std::size_t i = 0; i < Words; i++)
+            {
+                m_words[i] &= other.m_words[i];
+            }
+
+            return *this;
+        }
+
+        constexpr EnumSet& operator^=(const EnumSet& other)
+        {
+            for (std::size_t i = 0; i < Words; i++)
+            {
+                m_words[i] ^= other.m_words[i];
+            }
+
+            return *this;
+        }
+
+        constexpr EnumSet& operator-=(const EnumSet& other)
+        {
+            for (std::size_t i = 0; i < Words; i++)
+            {
+                m_words[i] &= ~other.m_words[i];
+            }
+
+            return *this;
+        }
+
+        constexpr EnumSet operator~() const
+        {
+            return EnumSet{*this}.flip();
+        }
+
+        /// @brief Shift the bits towards higher positions.
+        ///
+        /// @note Positions are only meaningful to shift for enumerations whose values are their positions.
+        constexpr EnumSet& operator<<=(std::size_t count)
+        {
+            std::size_t word_shift{count / WordBits};
+            std::size_t bit_shift{count % WordBits};
+
+            for (std::size_t i = Words; i-- > 0;)
+            {
+                Word word{0};
+
+                if (i >= word_shift)
+                {
+                    word = m_words[i - word_shift] << bit_shift;
+
+                    if (bit_shift != 0 && i > word_shift)
+                    {
+                        word |= m_words[i - word_shift - 1] >> (WordBits - bit_shift);
+                    }
+                }
+
+                m_words[i] = word;
+            }
+
+            trim();
+
+            return *this;
+        }
+
+        /// @brief Shift the bits towards lower positions.
+        ///
+        /// @note Positions are only meaningful to shift for enumerations whose values are their positions.
+        constexpr EnumSet& operator>>=(std::size_t count)
         {
-            set(static_cast<std::size_t>(pos), value);
+            std::size_t word_shift{count / WordBits};
+            std::size_t bit_shift{count % WordBits};
+
+            for (std::size_t i = 0; i < Words; i++)
+            {
+                Word word{0};
+
+                if ((i + word_shift) < Words)
+                {
+                    word = m_words[i + word_shift] >> bit_shift;
+
+                    if (bit_shift != 0 && (i + word_shift + 1) < Words)
+                    {
+                        word |= m_words[i + word_shift + 1] << (WordBits - bit_shift);
+                    }
+                }
+
+                m_words[i] = word;
+            }
 
             return *this;
         }
+
+        constexpr EnumSet operator<<(std::size_t count) const
+        {
+            return EnumSet{*this} <<= count;
+        }
+
+        constexpr EnumSet operator>>(std::size_t count) const
+        {
+            return EnumSet{*this} >>= count;
+        }
+
+        friend constexpr EnumSet operator|(EnumSet lhs, const EnumSet& rhs)
+        {
+            return lhs |= rhs;
+        }
+
+        friend constexpr EnumSet operator&(EnumSet lhs, const EnumSet& rhs)
+        {
+            return lhs &= rhs;
+        }
+
+        friend constexpr EnumSet operator^(EnumSet lhs, const EnumSet& rhs)
+        {
+            return lhs ^= rhs;
+        }
+
+        friend constexpr EnumSet operator-(EnumSet lhs, const EnumSet& rhs)
+        {
+            return lhs -= rhs;
+        }
+        /// @}
+
+        constexpr bool operator==(const EnumSet&) const = default;
+
+        /// @brief Stream operators, using the string representation of the bits (see `std::bitset`).
+        /// @{
+        template<class TChar, class TTraits>
+        friend std::basic_ostream<TChar, TTraits>& operator<<(std::basic_ostream<TChar, TTraits>& os,
+                                                              const EnumSet& set)
+        {
+            return os << static_cast<BaseType>(set);
+        }
+
+        template<class TChar, class TTraits>
+        friend std::basic_istream<TChar, TTraits>& operator>>(std::basic_istream<TChar, TTraits>& is, EnumSet& set)
+        {
+            BaseType bits{};
+
+            if (is >> bits)
+            {
+                set = EnumSet{bits};
+            }
+
+            return is;
+        }
+        /// @}
+
+    private:
+        template<class T>
+            requires std::is_enum_v<T>
+        friend class AtomicEnumSet;
+
+        /// @brief Convert an enumeration value to a bit position.
+        static constexpr std::size_t to_index(EnumType pos)
+        {
+            return Traits::index(pos);
+        }
+
+        /// @brief Obtain the mask of a bit within its word.
+        static constexpr Word mask(std::size_t pos)
+        {
+            return Word{1} << (pos % WordBits);
+        }
+
+        /// @brief Check that a position is valid.
+        ///
+        /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
+        static constexpr void check_bounds(std::size_t pos)
+        {
+            if (pos >= Size)
+            {
+                throw std::out_of_range("EnumSet position out of range");
+            }
+        }
+
+        /// @brief Access a bit without bound checking.
+        constexpr bool test_unchecked(std::size_t pos) const
+        {
+            return (m_words[pos / WordBits] & mask(pos)) != 0;
+        }
+
+        /// @brief Clear the unused bits of the last word.
+        constexpr void trim()
+        {
+            if constexpr ((Size % WordBits) != 0)
+            {
+                m_words[Words - 1] &= (Word{1} << (Size % WordBits)) - 1;
+            }
+        }
+
+        std::array<Word, Words> m_words;
+    };
+
+    /// @brief Atomic counterpart of the @ref EnumSet.
+    ///
+    /// @details
+    /// Each bit can be set, unset and tested from several threads without locking. Operations involving a whole set
+    /// (e.g. @ref fetch_or() or @ref load()) are atomic for each word, but not across words, which is only relevant
+    /// for enumerations with more than 64 values.
+    ///
+    /// @tparam TEnum               Enumeration type to use (see @ref EnumSet).
+    template<class TEnum>
+        requires std::is_enum_v<TEnum>
+    class AtomicEnumSet
+    {
+    public:
+        /// Enumeration type used.
+        using EnumType = TEnum;
+
+        /// Non-atomic set type.
+        using SetType = EnumSet<TEnum>;
+
+        /// Type of the words holding the bits.
+        using Word = typename SetType::Word;
+
+        /// @brief Constructor.
+        ///
+        /// @param[in] initial          Initial value of the bits.
+        AtomicEnumSet(const SetType& initial = SetType{})
+            : m_words{}
+        {
+            store(initial, std::memory_order_relaxed);
+        }
+
+        // Not copyable
+        AtomicEnumSet(const AtomicEnumSet&) = delete;
+        AtomicEnumSet& operator=(const AtomicEnumSet&) = delete;
+
+        // Not movable
+        AtomicEnumSet(AtomicEnumSet&&) = delete;
+        AtomicEnumSet& operator=(AtomicEnumSet&&) = delete;
+
+        /// @brief Check whether the operations on the set are lock-free.
+        static constexpr bool is_always_lock_free{std::atomic<Word>::is_always_lock_free};
+
+        /// @brief Obtain the number of bits in the set.
+        constexpr std::size_t size() const
+        {
+            return SetType::Size;
+        }
+
+        /// @brief Check the value of a specific bit.
+        ///
+        /// @param[in] pos          Position to check.
+        /// @param[in] order        Memory order of the operation.
+        ///
+        /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
+        bool test(EnumType pos, std::memory_order order = std::memory_order_seq_cst) const
+        {
+            auto index{position(pos)};
+
+            return (m_words[index / SetType::WordBits].load(order) & SetType::mask(index)) != 0;
+        }
+
+        /// @brief Set a specific bit.
+        ///
+        /// @param[in] pos          Position to set.
+        /// @param[in] order        Memory order of the operation.
+        ///
+        /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
+        void set(EnumType pos, std::memory_order order = std::memory_order_seq_cst)
+        {
+            test_and_set(pos, order);
+        }
+
+        /// @brief Unset a specific bit.
+        ///
+        /// @param[in] pos          Position to unset.
+        /// @param[in] order        Memory order of the operation.
+        ///
+        /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
+        void reset(EnumType pos, std::memory_order order = std::memory_order_seq_cst)
+        {
+            test_and_reset(pos, order);
+        }
+
+        /// @brief Set a specific bit, returning its previous value.
+        ///
+        /// @param[in] pos          Position to set.
+        /// @param[in] order        Memory order of the operation.
+        ///
+        /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
+        bool test_and_set(EnumType pos, std::memory_order order = std::memory_order_seq_cst)
+        {
+            auto index{position(pos)};
+            auto mask{SetType::mask(index)};
+
+            return (m_words[index / SetType::WordBits].fetch_or(mask, order) & mask) != 0;
+        }
+
+        /// @brief Unset a specific bit, returning its previous value.
+        ///
+        /// @param[in] pos          Position to unset.
+        /// @param[in] order        Memory order of the operation.
+        ///
+        /// @throws std::out_of_range if pos does not correspond to a valid position within the bitset.
+        bool test_and_reset(EnumType pos, std::memory_order order = std::memory_order_seq_cst)
+        {
+            auto index{position(pos)};
+            auto mask{SetType::mask(index)};
+
+            return (m_words[index / SetType::WordBits].fetch_and(~mask, order) & mask) != 0;
+        }
+
+        /// @brief Set the bits that are set in @p other, returning the previous value of the set.
+        ///
+        /// @param[in] other        Bits to set.
+        /// @param[in] order        Memory order of the operation.
+        SetType fetch_or(const SetType& other, std::memory_order order = std::memory_order_seq_cst)
+        {
+            SetType previous{};
+
+            for (std::size_t i = 0; i < SetType::Words; i++)
+            {
+                previous.m_words[i] = m_words[i].fetch_or(other.m_words[i], order);
+            }
+
+            return previous;
+        }
+
+        /// @brief Keep only the bits that are set in @p other, returning the previous value of the set.
+        ///
+        /// @param[in] other        Bits to keep.
+        /// @param[in] order        Memory order of the operation.
+        SetType fetch_and(const SetType& other, std::memory_order order = std::memory_order_seq_cst)
+        {
+            SetType previous{};
+
+            for (std::size_t i = 0; i < SetType::Words; i++)
+            {
+                previous.m_words[i] = m_words[i].fetch_and(other.m_words[i], order);
+            }
+
+            return previous;
+        }
+
+        /// @brief Obtain a snapshot of the bits.
+        ///
+        /// @param[in] order        Memory order of the operation.
+        SetType load(std::memory_order order = std::memory_order_seq_cst) const
+        {
+            SetType result{};
+
+            for (std::size_t i = 0; i < SetType::Words; i++)
+            {
+                result.m_words[i] = m_words[i].load(order);
+            }
+
+            return result;
+        }
+
+        /// @brief Replace the bits.
+        ///
+        /// @param[in] value        New value of the bits.
+        /// @param[in] order        Memory order of the operation.
+        void store(const SetType& value, std::memory_order order = std::memory_order_seq_cst)
+        {
+            for (std::size_t i = 0; i < SetType::Words; i++)
+            {
+                m_words[i].store(value.m_words[i], order);
+            }
+        }
+
+    private:
+        /// @brief Convert a position, checking its bounds.
+        static std::size_t position(EnumType pos)
+        {
+            auto index{SetType::to_index(pos)};
+
+            SetType::check_bounds(index);
+
+            return index;
+        }
+
+        std::array<std::atomic<Word>, SetType::Words> m_words;
     };
 }  // namespace kouta::utils
+
+/// @brief Hash support for the @ref kouta::utils::EnumSet.
+template<class TEnum>
+struct std::hash<kouta::utils::EnumSet<TEnum>>
+{
+    std::size_t operator()(const kouta::utils::EnumSet<TEnum>& set) const noexcept
+    {
+        using Set = kouta::utils::EnumSet<TEnum>;
+
+        std::size_t result{0};
+
+        for (std::size_t i = 0; i < Set::Words; i++)
+        {
+            // Combine the hashes of the words
+            result ^= std::hash<typename Set::Word>{}(set.word(i)) + 0x9E3779B97F4A7C15 + (result << 6) + (result >> 2);
+        }
+
+        return result;
+    }
+};
@@ -0,0 +1,209 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/arena.hpp>
+#include <kouta/base/component.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::tests::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// @brief Memory resource that keeps track of the outstanding allocations.
+        class CountingResource : public std::pmr::memory_resource
+        {
+        public:
+            std::size_t allocations{0};
+            std::size_t outstanding{0};
+
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override
+            {
+                allocations++;
+                outstanding++;
+
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+            {
+                outstanding--;
+
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return this == &other;
+            }
+        };
+
+        /// @brief Root that allocates its children from a counting resource.
+        class CountingRoot : public Root
+        {
+        public:
+            std::pmr::memory_resource* memory_resource() override
+            {
+                return &resource;
+            }
+
+            CountingResource resource;
+        };
+
+        /// @brief Component that records its deletion.
+        class Tracked : public Component
+        {
+        public:
+            Tracked(Component* parent, std::vector<Tracked*>* deleted, bool fail = false)
+                : Component{parent}
+                , m_deleted{deleted}
+                , m_payload{}
+            {
+                if (fail)
+                {
+                    throw std::runtime_error("construction failed");
+                }
+            }
+
+            ~Tracked() override
+            {
+                m_deleted->push_back(this);
+            }
+
+        private:
+            std::vector<Tracked*>* m_deleted;
+            std::byte m_payload[48];
+        };
+
+        /// @brief Component with new-extended alignment.
+        class OverAligned : public Component
+        {
+        public:
+            explicit OverAligned(Component* parent)
+                : Component{parent}
+                , payload{}
+            {
+            }
+
+            alignas(64) std::byte payload[64];
+        };
+    }  // namespace
+
+    /// @brief Test creating children with the memory resource of the parent.
+    ///
+    /// @details
+    /// The test succeeds if the children are allocated from the resource of the root, inherited by its descendants,
+    /// and returned to it when deleted.
+    TEST(BaseTest, MakeChild)
+    {
+        CountingRoot root{};
+        std::vector<Tracked*> deleted{};
+
+        auto* parent{make_child<Tracked>(&root, &deleted)};
+        auto* child{make_child<Tracked>(parent, &deleted)};
+        auto* heap_child{new Tracked{parent, &deleted}};
+
+        EXPECT_EQ(parent->memory_resource(), &root.resource);
+        EXPECT_EQ(root.resource.allocations, 2);
+        EXPECT_EQ(root.resource.outstanding, 2);
+
+        // Failed constructions release their memory
+        EXPECT_THROW(make_child<Tracked>(parent, &deleted, true), std::runtime_error);
+        EXPECT_EQ(root.resource.outstanding, 2);
+
+        delete parent;
+
+        EXPECT_EQ(deleted, (std::vector<Tracked*>{parent, heap_child, child}));
+        EXPECT_EQ(root.resource.outstanding, 0);
+    }
+
+    /// @brief Test allocating a subtree in an arena.
+    ///
+    /// @details
+    /// The test succeeds if the subtree only takes a few allocations from the upstream resource, and all of them are
+    /// released when the arena is deleted.
+    TEST(BaseTest, ArenaSubtree)
+    {
+        CountingRoot root{};
+        std::vector<Tracked*> deleted{};
+
+        auto* arena{make_child<Arena>(&root, 1024)};
+
+        EXPECT_EQ(root.resource.allocations, 1);
+
+        auto* first{make_child<Tracked>(arena, &deleted)};
+
+        for (std::size_t i = 0; i < 100; i++)
+        {
+            make_child<Tracked>(first, &deleted);
+        }
+
+        EXPECT_EQ(first->memory_resource(), arena->memory_resource());
+        EXPECT_LT(root.resource.allocations, 10);
+
+        // Deleting a component of the subtree does not release its memory
+        auto* last{make_child<Tracked>(arena, &deleted)};
+        auto outstanding{root.resource.outstanding};
+
+        delete last;
+
+        EXPECT_EQ(root.resource.outstanding, outstanding);
+
+        delete arena;
+
+        EXPECT_EQ(deleted.size(), 102);
+        EXPECT_EQ(root.resource.outstanding, 0);
+    }
+
+    /// @brief Test deleting over-aligned components.
+    ///
+    /// @details
+    /// The test succeeds if components allocated with the aligned `operator new` (or through @ref make_child()) are
+    /// released with the matching deallocation function, whether deleted directly or by their parent. The mismatch is
+    /// detected by the address sanitizer.
+    TEST(BaseTest, OverAlignedDelete)
+    {
+        CountingRoot root{};
+
+        auto* standalone{new OverAligned{nullptr}};
+
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(standalone) % alignof(OverAligned), 0);
+
+        delete standalone;
+
+        auto* heap_child{new OverAligned{&root}};
+        auto* pool_child{make_child<OverAligned>(&root)};
+
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(heap_child) % alignof(OverAligned), 0);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pool_child) % alignof(OverAligned), 0);
+        EXPECT_EQ(root.resource.outstanding, 1);
+
+        delete pool_child;
+
+        EXPECT_EQ(root.resource.outstanding, 0);
+    }
+
+    /// @brief Test that children allocated from the pool of the root are deleted before the pool is destroyed.
+    TEST(BaseTest, RootPool)
+    {
+        std::vector<Tracked*> deleted{};
+
+        {
+            Root root{};
+            auto* arena{make_child<Arena>(&root)};
+
+            make_child<Tracked>(&root, &deleted);
+            make_child<Tracked>(arena, &deleted);
+        }
+
+        EXPECT_EQ(deleted.size(), 2);
+    }
+}  // namespace kouta::tests::base
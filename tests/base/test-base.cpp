@@ -445,6 +445,44 @@ namespace kouta::tests::base
         root.run();
     }
 
+    /// @brief Test adding and removing children from the list of a component.
+    ///
+    /// @details
+    /// The test succeeds if the children are deleted in reverse order, except for those that were removed from the
+    /// list, and removing a component that is not in the list has no effect.
+    TEST(BaseTest, ChildrenList)
+    {
+        Root root{};
+        std::vector<Component*> deleted{};
+        callback::DirectCallback<Component*> on_delete{[&deleted](Component* component)
+                                                       {
+                                                           deleted.push_back(component);
+                                                       }};
+
+        auto* parent = new DummyComponent{&root, on_delete};
+        auto* comp_a = new DummyComponent{parent, on_delete};
+        auto* comp_b = new DummyComponent{parent, on_delete};
+        auto* comp_c = new DummyComponent{parent, on_delete};
+        auto* comp_d = new DummyComponent{parent, on_delete};
+
+        // Removed children are not deleted by the parent
+        parent->remove_child(comp_b);
+        parent->remove_child(comp_b);
+        root.remove_child(comp_c);
+
+        // Moving a child to another list removes it from the previous one
+        comp_a->add_child(comp_d);
+
+        delete parent;
+
+        // Each component notifies its deletion before deleting its own children
+        EXPECT_EQ(deleted, (std::vector<Component*>{parent, comp_c, comp_a, comp_d}));
+
+        delete comp_b;
+
+        EXPECT_EQ(deleted.back(), comp_b);
+    }
+
     /// @brief Test the behaviour of a component tree when allocated in the stack.
     ///
     /// @details
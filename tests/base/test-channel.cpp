@@ -0,0 +1,159 @@
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/callback.hpp>
+#include <kouta/base/channel.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::tests::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// @brief Root that receives the items of a channel.
+        class ChannelRoot : public Root
+        {
+        public:
+            explicit ChannelRoot(std::size_t capacity)
+                : Root{}
+                , channel{this, callback::DirectCallback{this, &ChannelRoot::handle_item}, capacity}
+                , received{}
+                , expected{0}
+            {
+            }
+
+            Channel<std::uint64_t> channel;
+            std::vector<std::uint64_t> received;
+            std::size_t expected;
+
+        private:
+            void handle_item(const std::uint64_t& item)
+            {
+                received.push_back(item);
+
+                if (received.size() == expected)
+                {
+                    stop();
+                }
+            }
+        };
+    }  // namespace
+
+    /// @brief Test the capacity of the channel and the batching of items.
+    ///
+    /// @details
+    /// The test succeeds if the channel rejects items when full, and all the items are delivered with a single drain.
+    TEST(BaseTest, ChannelBatching)
+    {
+        ChannelRoot root{10};
+
+        ASSERT_EQ(root.channel.capacity(), 16);
+
+        for (std::uint64_t i = 0; i < 16; i++)
+        {
+            ASSERT_TRUE(root.channel.try_send(i));
+        }
+
+        ASSERT_FALSE(root.channel.try_send(16));
+
+        root.expected = 16;
+
+        // A single handler delivers all the items
+        ASSERT_EQ(root.context().poll(), 1);
+        ASSERT_EQ(root.received.size(), 16);
+
+        for (std::uint64_t i = 0; i < 16; i++)
+        {
+            ASSERT_EQ(root.received[i], i);
+        }
+
+        // Room is available again
+        ASSERT_TRUE(root.channel.try_send(16));
+    }
+
+    /// @brief Test sending items from another thread.
+    ///
+    /// @details
+    /// The test succeeds if all the items are received in order.
+    TEST(BaseTest, ChannelThreads)
+    {
+        ChannelRoot root{64};
+
+        root.expected = 100000;
+
+        std::thread producer{[&root]()
+                             {
+                                 for (std::uint64_t i = 0; i < root.expected; i++)
+                                 {
+                                     while (!root.channel.try_send(i))
+                                     {
+                                         std::this_thread::yield();
+                                     }
+                                 }
+                             }};
+
+        alarm(5);
+        root.run();
+        alarm(0);
+
+        producer.join();
+
+        ASSERT_EQ(root.received.size(), root.expected);
+
+        for (std::uint64_t i = 0; i < root.expected; i++)
+        {
+            ASSERT_EQ(root.received[i], i);
+        }
+    }
+
+    /// @brief Test sending items while the gate of the consumer rejects or drops events.
+    ///
+    /// @details
+    /// The test succeeds if every item sent after a drain is dropped attempts to schedule another one (which is then
+    /// rejected), instead of the channel waiting forever for the dropped drain.
+    TEST(BaseTest, ChannelGate)
+    {
+        ChannelRoot root{8};
+
+        ASSERT_TRUE(root.channel.try_send(1));
+
+        root.gate()->discard();
+        root.context().poll();
+
+        ASSERT_EQ(root.gate()->dropped(), 1);
+
+        ASSERT_TRUE(root.channel.try_send(2));
+        ASSERT_TRUE(root.channel.try_send(3));
+
+        ASSERT_EQ(root.gate()->rejected(), 2);
+        ASSERT_TRUE(root.received.empty());
+    }
+
+    /// @brief Test destroying a channel with pending items.
+    ///
+    /// @details
+    /// The test succeeds if the pending items are destroyed along with the channel.
+    TEST(BaseTest, ChannelPendingItems)
+    {
+        Root root{};
+        auto item{std::make_shared<int>(42)};
+
+        {
+            Channel<std::shared_ptr<int>> channel{
+                &root,
+                callback::DirectCallback<const std::shared_ptr<int>&>{[](const std::shared_ptr<int>&) {}}};
+
+            ASSERT_TRUE(channel.try_send(item));
+            ASSERT_TRUE(channel.try_send(item));
+            ASSERT_EQ(item.use_count(), 3);
+        }
+
+        ASSERT_EQ(item.use_count(), 1);
+    }
+}  // namespace kouta::tests::base
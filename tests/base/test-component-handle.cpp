@@ -0,0 +1,165 @@
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/branch.hpp>
+#include <kouta/base/component-handle.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::tests::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        /// @brief Component that records the values it receives.
+        class Receiver : public Component
+        {
+        public:
+            explicit Receiver(Component* parent, std::vector<std::uint32_t>* values = nullptr)
+                : Component{parent}
+                , received{0}
+                , m_values{values}
+            {
+            }
+
+            void handle_value(std::uint32_t value)
+            {
+                if (m_values)
+                {
+                    m_values->push_back(value);
+                }
+
+                received.fetch_add(1, std::memory_order_release);
+            }
+
+            std::atomic<std::uint32_t> received;
+
+        private:
+            std::vector<std::uint32_t>* m_values;
+        };
+
+        /// @brief Run the pending events of a root.
+        void run_pending(Root& root)
+        {
+            root.post(
+                [&root]()
+                {
+                    root.stop();
+                });
+            root.run();
+            root.context().restart();
+        }
+    }  // namespace
+
+    /// @brief Test posting through handles to components that are destroyed while events are pending.
+    ///
+    /// @details
+    /// The test succeeds if the events posted through stale handles are dropped, even after the slot is reused.
+    TEST(BaseTest, ComponentHandleStale)
+    {
+        Root root{};
+        std::vector<std::uint32_t> values{};
+
+        auto* receiver{new Receiver{&root, &values}};
+        ComponentHandle handle{receiver};
+
+        EXPECT_FALSE(handle.empty());
+        EXPECT_EQ(handle.get(), receiver);
+        EXPECT_EQ(ComponentHandle{receiver}, handle);
+        EXPECT_EQ(root.handle_table()->size(), 1);
+
+        handle.post(&Receiver::handle_value, 1);
+        handle.post(
+            [](Receiver& target)
+            {
+                target.handle_value(2);
+            });
+
+        run_pending(root);
+
+        EXPECT_EQ(values, (std::vector<std::uint32_t>{1, 2}));
+
+        // Destroy the component while an event is pending
+        handle.post(&Receiver::handle_value, 3);
+        delete receiver;
+
+        EXPECT_EQ(handle.get(), nullptr);
+        EXPECT_EQ(root.handle_table()->size(), 0);
+
+        // The slot is reused, but the previous handle remains stale
+        auto* other{new Receiver{&root, &values}};
+        ComponentHandle other_handle{other};
+
+        EXPECT_EQ(root.handle_table()->capacity(), 1);
+        EXPECT_EQ(handle.get(), nullptr);
+        EXPECT_EQ(other_handle.get(), other);
+
+        handle.post(&Receiver::handle_value, 4);
+        other_handle.post(&Receiver::handle_value, 5);
+
+        run_pending(root);
+
+        EXPECT_EQ(values, (std::vector<std::uint32_t>{1, 2, 5}));
+    }
+
+    /// @brief Test empty handles and components without a root.
+    TEST(BaseTest, ComponentHandleEmpty)
+    {
+        ComponentHandle<Receiver> handle{};
+        Receiver orphan{nullptr};
+
+        EXPECT_TRUE(handle.empty());
+        EXPECT_EQ(handle.get(), nullptr);
+        EXPECT_NO_THROW(handle.post(&Receiver::handle_value, 1));
+        EXPECT_THROW(ComponentHandle{&orphan}, std::logic_error);
+    }
+
+    /// @brief Test posting through a handle to a component in another thread.
+    ///
+    /// @details
+    /// The test succeeds if events are delivered while the component exists, and dropped afterwards.
+    TEST(BaseTest, ComponentHandleBranch)
+    {
+        Branch<Receiver> branch{nullptr};
+        ComponentHandle handle{&branch.component()};
+        auto* child{new Receiver{&branch.component()}};
+        ComponentHandle child_handle{child};
+
+        EXPECT_EQ(branch.handle_table()->size(), 2);
+
+        branch.run();
+
+        for (std::uint32_t i = 0; i < 100; i++)
+        {
+            handle.post(&Receiver::handle_value, i);
+            child_handle.post(&Receiver::handle_value, i);
+        }
+
+        // Delete the child from its own thread, while events are pending
+        handle.post(
+            [child](Receiver&)
+            {
+                delete child;
+            });
+
+        for (std::uint32_t i = 0; i < 100; i++)
+        {
+            child_handle.post(&Receiver::handle_value, i);
+        }
+
+        handle.post(&Receiver::handle_value, 100);
+
+        while (branch.component().received.load(std::memory_order_acquire) < 101)
+        {
+            std::this_thread::yield();
+        }
+
+        EXPECT_EQ(branch.handle_table()->size(), 1);
+    }
+}  // namespace kouta::tests::base
@@ -0,0 +1,201 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/branch.hpp>
+#include <kouta/base/gate.hpp>
+#include <kouta/base/lanes.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::tests::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        /// @brief Component that counts the events it receives, optionally forwarding them to another component.
+        class Counter : public Component
+        {
+        public:
+            explicit Counter(Component* parent, Counter* next = nullptr)
+                : Component{parent}
+                , received{0}
+                , m_next{next}
+            {
+            }
+
+            void handle_value(std::uint32_t value)
+            {
+                received.fetch_add(1, std::memory_order_relaxed);
+
+                if (m_next)
+                {
+                    m_next->post(&Counter::handle_value, value);
+                }
+            }
+
+            /// @brief Keep posting to itself, so that the queue never becomes empty.
+            void handle_loop()
+            {
+                received.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::sleep_for(1ms);
+                post(&Counter::handle_loop);
+            }
+
+            std::atomic<std::uint32_t> received;
+
+        private:
+            Counter* m_next;
+        };
+
+        /// @brief Obtain a deadline relative to the current time.
+        std::chrono::steady_clock::time_point after(std::chrono::milliseconds duration)
+        {
+            return std::chrono::steady_clock::now() + duration;
+        }
+    }  // namespace
+
+    /// @brief Test draining the queue of a root.
+    ///
+    /// @details
+    /// The test succeeds if all the queued events are executed, and posts from other threads are rejected afterwards.
+    TEST(BaseTest, DrainRoot)
+    {
+        Root root{};
+        Counter counter{&root};
+
+        for (std::uint32_t i = 0; i < 100; i++)
+        {
+            counter.post(&Counter::handle_value, i);
+        }
+
+        EXPECT_EQ(root.gate()->state(), Gate::State::Open);
+        EXPECT_EQ(root.drain(after(5s)), 0);
+        EXPECT_EQ(counter.received, 100);
+
+        std::thread other{[&counter]()
+                          {
+                              counter.post(&Counter::handle_value, 0);
+                          }};
+
+        other.join();
+
+        EXPECT_EQ(root.gate()->rejected(), 1);
+    }
+
+    /// @brief Test draining a queue that does not become empty before the deadline.
+    ///
+    /// @details
+    /// The test succeeds if the drain returns after the deadline and reports the dropped event.
+    TEST(BaseTest, DrainRootDeadline)
+    {
+        Root root{};
+        Counter counter{&root};
+
+        counter.post(&Counter::handle_loop);
+
+        auto start{std::chrono::steady_clock::now()};
+
+        EXPECT_EQ(root.drain(after(50ms)), 1);
+        EXPECT_GE(std::chrono::steady_clock::now() - start, 50ms);
+        EXPECT_GT(counter.received, 0);
+    }
+
+    /// @brief Test draining running branches in dependency order.
+    ///
+    /// @details
+    /// Branch b forwards every event to branch a, which was created first. The test succeeds if b is drained before
+    /// a, so that no event is lost, and the worker threads are joined.
+    TEST(BaseTest, DrainBranches)
+    {
+        Root root{};
+        Branch<Counter> branch_a{&root};
+        Branch<Counter> branch_b{&root, &branch_a.component()};
+
+        branch_a.run();
+        branch_b.run();
+
+        for (std::uint32_t i = 0; i < 1000; i++)
+        {
+            branch_b.post(&Counter::handle_value, i);
+        }
+
+        EXPECT_EQ(root.drain(after(5s)), 0);
+        EXPECT_EQ(branch_b.component().received, 1000);
+        EXPECT_EQ(branch_a.component().received, 1000);
+        EXPECT_EQ(branch_a.gate()->state(), Gate::State::Discarding);
+    }
+
+    /// @brief Test the final pass of a drain that reaches its deadline.
+    ///
+    /// @details
+    /// An ungated handler keeps re-posting itself, and a backlog of slow events is queued in a lane. The test succeeds
+    /// if the drain returns, and every laned event is either executed or counted as dropped.
+    TEST(BaseTest, DrainRootFinalPass)
+    {
+        constexpr std::uint32_t EventCount{10};
+
+        Root root{};
+        Counter counter{&root};
+        std::function<void()> spin{};
+        std::uint32_t spins{0};
+
+        spin = [&root, &spin, &spins]()
+        {
+            spins++;
+            asio::post(root.context(), spin);
+        };
+
+        asio::post(root.context(), spin);
+
+        for (std::uint32_t i = 0; i < EventCount; i++)
+        {
+            counter.post<Priority::Bulk>(
+                [&counter]()
+                {
+                    counter.received.fetch_add(1, std::memory_order_relaxed);
+                    std::this_thread::sleep_for(10ms);
+                });
+        }
+
+        auto dropped{root.drain(after(25ms))};
+
+        EXPECT_GT(dropped, 0);
+        EXPECT_LT(counter.received, EventCount);
+        EXPECT_EQ(counter.received + dropped, EventCount);
+        EXPECT_GT(spins, 0);
+    }
+
+    /// @brief Test draining a branch whose subtree is not drained before the deadline.
+    ///
+    /// @details
+    /// The wrapped component of the outer branch owns an inner branch, whose event loop never becomes empty, and is
+    /// busy when the drain starts. The test succeeds if the inner branch is still drained and its dropped event is
+    /// counted.
+    TEST(BaseTest, DrainBranchSubtreeDeadline)
+    {
+        Root root{};
+        Branch<Counter> outer{&root};
+        auto* inner{new Branch<Counter>{&outer.component()}};
+
+        outer.run();
+        inner->run();
+
+        inner->component().post(&Counter::handle_loop);
+        outer.component().post(
+            []()
+            {
+                std::this_thread::sleep_for(100ms);
+            });
+
+        EXPECT_GE(outer.drain(after(20ms)), 1);
+        EXPECT_EQ(inner->gate()->state(), Gate::State::Discarding);
+    }
+}  // namespace kouta::tests::base
@@ -0,0 +1,438 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/branch.hpp>
+#include <kouta/base/lanes.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::tests::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        /// @brief Component that records the priority of the events it receives.
+        class Recorder : public Component
+        {
+        public:
+            explicit Recorder(Component* parent)
+                : Component{parent}
+                , priorities{}
+                , values{}
+            {
+            }
+
+            void handle_event(Priority priority)
+            {
+                priorities.push_back(priority);
+            }
+
+            void handle_value(std::uint32_t value)
+            {
+                values.push_back(value);
+            }
+
+            void handle_block(std::array<std::uint32_t, 64> block)
+            {
+                values.push_back(block.back());
+            }
+
+            void handle_failure()
+            {
+                throw std::runtime_error{"Failure"};
+            }
+
+            std::vector<Priority> priorities;
+            std::vector<std::uint32_t> values;
+        };
+
+        /// @brief Component that checks the order of the events pushed by several producers.
+        class Sequencer : public Component
+        {
+        public:
+            static constexpr std::size_t Producers{4};
+
+            explicit Sequencer(Component* parent)
+                : Component{parent}
+                , next{}
+                , out_of_order{0}
+                , received{0}
+            {
+            }
+
+            void handle_value(std::size_t producer, std::uint32_t value)
+            {
+                if (value != next[producer])
+                {
+                    out_of_order++;
+                }
+
+                next[producer] = value + 1;
+                received.fetch_add(1, std::memory_order_release);
+            }
+
+            std::array<std::uint32_t, Producers> next;
+            std::uint32_t out_of_order;
+            std::atomic<std::uint32_t> received;
+        };
+
+        /// @brief Component that receives a backlog of bulk events and control events.
+        class Streamer : public Component
+        {
+        public:
+            explicit Streamer(Component* parent)
+                : Component{parent}
+                , frames{0}
+                , frames_before_control{0}
+                , control_handled{false}
+            {
+            }
+
+            /// @brief Handle a bulk frame, which takes a while to process.
+            void handle_frame(std::uint32_t)
+            {
+                auto until{std::chrono::steady_clock::now() + 20us};
+
+                while (std::chrono::steady_clock::now() < until)
+                {
+                }
+
+                frames.fetch_add(1, std::memory_order_release);
+            }
+
+            /// @brief Handle a control message.
+            void handle_control()
+            {
+                frames_before_control = frames.load(std::memory_order_acquire);
+                control_handled.store(true, std::memory_order_release);
+            }
+
+            std::atomic<std::uint32_t> frames;
+            std::uint32_t frames_before_control;
+            std::atomic<bool> control_handled;
+        };
+
+        /// @brief Run the pending events of a root.
+        void run_pending(Root& root)
+        {
+            root.context().restart();
+            root.context().poll();
+        }
+    }  // namespace
+
+    /// @brief Test the order in which the lanes are drained.
+    ///
+    /// @details
+    /// The test succeeds if each round executes as many events of each lane as its weight, from the highest priority
+    /// to the lowest, and events posted without a priority are executed in between rounds.
+    TEST(BaseTest, LanesWeights)
+    {
+        Root root{};
+        Recorder recorder{&root};
+
+        ASSERT_NE(root.lanes(), nullptr);
+        EXPECT_EQ(recorder.lanes(), root.lanes());
+
+        root.lanes()->set_weight(Priority::High, 2);
+        root.lanes()->set_weight(Priority::Normal, 1);
+        root.lanes()->set_weight(Priority::Bulk, 0);
+
+        EXPECT_EQ(root.lanes()->weight(Priority::Bulk), 1);
+
+        for (std::uint32_t i = 0; i < 4; i++)
+        {
+            recorder.post<Priority::Bulk>(&Recorder::handle_event, Priority::Bulk);
+            recorder.post<Priority::Normal>(&Recorder::handle_event, Priority::Normal);
+        }
+
+        recorder.post<Priority::High>(&Recorder::handle_event, Priority::High);
+        recorder.post<Priority::High>(&Recorder::handle_event, Priority::High);
+        recorder.post<Priority::High>(&Recorder::handle_event, Priority::High);
+
+        // Without a priority, executed after the first round
+        recorder.post(
+            [&recorder]()
+            {
+                recorder.priorities.push_back(Priority{Lanes::Count});
+            });
+
+        EXPECT_EQ(root.lanes()->size(Priority::Bulk), 4);
+        EXPECT_EQ(root.lanes()->size(Priority::High), 3);
+
+        run_pending(root);
+
+        const std::vector<Priority> expected{
+            // First round
+            Priority::High,
+            Priority::High,
+            Priority::Normal,
+            Priority::Bulk,
+            // Unprioritized
+            Priority{Lanes::Count},
+            // Second round
+            Priority::High,
+            Priority::Normal,
+            Priority::Bulk,
+            // Third and fourth rounds
+            Priority::Normal,
+            Priority::Bulk,
+            Priority::Normal,
+            Priority::Bulk,
+        };
+
+        EXPECT_EQ(recorder.priorities, expected);
+        EXPECT_EQ(root.lanes()->size(Priority::Bulk), 0);
+    }
+
+    /// @brief Test the latency of a control message while the bulk lane is saturated.
+    ///
+    /// @details
+    /// A backlog of bulk frames (around 100 ms worth of processing) is queued before a high priority control message.
+    /// The test succeeds if the control message overtakes the backlog, waiting at most for the round in progress (a
+    /// single frame, with a bulk weight of one) and the frame that may complete while it is being posted.
+    TEST(BaseTest, LanesControlLatency)
+    {
+        constexpr std::uint32_t FrameCount{5000};
+
+        Branch<Streamer> branch{nullptr};
+        auto& streamer{branch.component()};
+
+        branch.lanes()->set_weight(Priority::Bulk, 1);
+
+        for (std::uint32_t i = 0; i < FrameCount; i++)
+        {
+            streamer.post<Priority::Bulk>(&Streamer::handle_frame, i);
+        }
+
+        branch.run();
+
+        // Let the backlog start being processed
+        while (streamer.frames.load(std::memory_order_acquire) == 0)
+        {
+            std::this_thread::yield();
+        }
+
+        auto frames_at_post{streamer.frames.load(std::memory_order_acquire)};
+
+        streamer.post<Priority::High>(&Streamer::handle_control);
+
+        while (!streamer.control_handled.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+
+        EXPECT_LE(streamer.frames_before_control - frames_at_post, 2);
+
+        while (streamer.frames.load(std::memory_order_acquire) < FrameCount)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    /// @brief Test that high priority events overtake the handlers already queued in the event loop.
+    ///
+    /// @details
+    /// The test succeeds if, when running the event loop of the Root, a high priority event is executed right after
+    /// the handler in progress, while lower priority events still wait for their round.
+    TEST(BaseTest, LanesExpedite)
+    {
+        Root root{};
+        Recorder recorder{&root};
+
+        for (std::uint32_t i = 0; i < 3; i++)
+        {
+            recorder.post(
+                [&recorder]()
+                {
+                    recorder.priorities.push_back(Priority{Lanes::Count});
+                });
+        }
+
+        recorder.post<Priority::Bulk>(&Recorder::handle_event, Priority::Bulk);
+        recorder.post<Priority::High>(&Recorder::handle_event, Priority::High);
+        recorder.post(
+            [&root]()
+            {
+                root.stop();
+            });
+
+        root.run();
+
+        const std::vector<Priority> expected{
+            Priority{Lanes::Count},
+            Priority::High,
+            Priority{Lanes::Count},
+            Priority{Lanes::Count},
+            Priority::Bulk,
+        };
+
+        EXPECT_EQ(recorder.priorities, expected);
+    }
+
+    /// @brief Test an event that throws.
+    ///
+    /// @details
+    /// The test succeeds if the exception propagates to the event loop, and the remaining and later events are still
+    /// executed.
+    TEST(BaseTest, LanesThrowingEvent)
+    {
+        Root root{};
+        Recorder recorder{&root};
+
+        recorder.post<Priority::High>(&Recorder::handle_failure);
+        recorder.post<Priority::Normal>(&Recorder::handle_event, Priority::Normal);
+
+        EXPECT_THROW(run_pending(root), std::runtime_error);
+        EXPECT_TRUE(recorder.priorities.empty());
+
+        run_pending(root);
+
+        EXPECT_EQ(recorder.priorities, (std::vector<Priority>{Priority::Normal}));
+
+        recorder.post<Priority::Bulk>(&Recorder::handle_event, Priority::Bulk);
+        run_pending(root);
+
+        EXPECT_EQ(recorder.priorities, (std::vector<Priority>{Priority::Normal, Priority::Bulk}));
+        EXPECT_EQ(root.lanes()->size(Priority::High), 0);
+    }
+
+    /// @brief Test queueing more events than fit in a lane, and events that do not fit in a cell.
+    ///
+    /// @details
+    /// The test succeeds if the events that overflow the lane and those stored on the heap are executed in order.
+    TEST(BaseTest, LanesOverflow)
+    {
+        constexpr std::uint32_t EventCount{Lanes::Capacity * 3};
+
+        Root root{};
+        Recorder recorder{&root};
+
+        root.lanes()->set_weight(Priority::Bulk, 50);
+
+        std::vector<std::uint32_t> expected{};
+
+        for (std::uint32_t i = 0; i < EventCount; i++)
+        {
+            if (i % 100 == 0)
+            {
+                std::array<std::uint32_t, 64> block{};
+                block.back() = i;
+
+                recorder.post<Priority::Bulk>(&Recorder::handle_block, block);
+            }
+            else
+            {
+                recorder.post<Priority::Bulk>(&Recorder::handle_value, i);
+            }
+
+            expected.push_back(i);
+        }
+
+        EXPECT_EQ(root.lanes()->size(Priority::Bulk), EventCount);
+
+        run_pending(root);
+
+        EXPECT_EQ(recorder.values, expected);
+        EXPECT_EQ(root.lanes()->size(Priority::Bulk), 0);
+
+        // The lane is usable again once drained
+        recorder.post<Priority::Bulk>(&Recorder::handle_value, EventCount);
+        run_pending(root);
+
+        EXPECT_EQ(recorder.values.back(), EventCount);
+    }
+
+    /// @brief Test pushing events from several threads while the lanes are drained.
+    ///
+    /// @details
+    /// The test succeeds if all the events are executed, in the order each producer pushed them.
+    TEST(BaseTest, LanesConcurrentPush)
+    {
+        constexpr std::uint32_t EventCount{20000};
+
+        Branch<Sequencer> branch{nullptr};
+        auto& sequencer{branch.component()};
+
+        branch.run();
+
+        std::vector<std::thread> producers{};
+
+        for (std::size_t producer = 0; producer < Sequencer::Producers; producer++)
+        {
+            producers.emplace_back(
+                [&sequencer, producer]()
+                {
+                    for (std::uint32_t i = 0; i < EventCount; i++)
+                    {
+                        sequencer.post<Priority::Normal>(&Sequencer::handle_value, producer, i);
+                    }
+                });
+        }
+
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+
+        while (sequencer.received.load(std::memory_order_acquire) < EventCount * Sequencer::Producers)
+        {
+            std::this_thread::yield();
+        }
+
+        EXPECT_EQ(sequencer.out_of_order, 0);
+        EXPECT_EQ(branch.lanes()->size(Priority::Normal), 0);
+    }
+
+    /// @brief Test posting with a priority to a component without a Root.
+    ///
+    /// @details
+    /// The test succeeds if the event is posted directly to the event loop.
+    TEST(BaseTest, LanesWithoutRoot)
+    {
+        asio::io_context context{};
+
+        class Orphan : public Component
+        {
+        public:
+            explicit Orphan(asio::io_context& context)
+                : Component{nullptr}
+                , m_context{context}
+            {
+            }
+
+            asio::io_context& context() override
+            {
+                return m_context;
+            }
+
+        private:
+            asio::io_context& m_context;
+        };
+
+        Orphan orphan{context};
+        bool handled{false};
+
+        EXPECT_EQ(orphan.lanes(), nullptr);
+
+        orphan.post<Priority::High>(
+            [&handled]()
+            {
+                handled = true;
+            });
+
+        context.poll();
+
+        EXPECT_TRUE(handled);
+    }
+}  // namespace kouta::tests::base
@@ -0,0 +1,277 @@
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/branch.hpp>
+#include <kouta/base/message-bus.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::tests::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        struct Number
+        {
+            std::uint32_t value;
+        };
+
+        struct Text
+        {
+            std::string value;
+        };
+
+        /// @brief Component that records the messages it receives.
+        class Listener : public Component
+        {
+        public:
+            explicit Listener(Component* parent)
+                : Component{parent}
+                , numbers{}
+                , threads{}
+                , mutex{}
+            {
+            }
+
+            void handle_number(const Number& message)
+            {
+                std::lock_guard lock{mutex};
+
+                numbers.push_back(message.value);
+                threads.push_back(std::this_thread::get_id());
+            }
+
+            std::size_t received()
+            {
+                std::lock_guard lock{mutex};
+
+                return numbers.size();
+            }
+
+            std::vector<std::uint32_t> numbers;
+            std::vector<std::thread::id> threads;
+            std::mutex mutex;
+        };
+
+        /// @brief Secondary base of a listener, whose methods require adjusting the subscriber pointer.
+        struct Tag
+        {
+            virtual ~Tag() = default;
+
+            void handle_tagged(const Number& message)
+            {
+                tagged.push_back(message.value + tag);
+            }
+
+            std::uint32_t tag{7};
+            std::vector<std::uint32_t> tagged{};
+        };
+
+        /// @brief Listener with a virtual handler, and a handler inherited from a secondary base.
+        class TaggedListener : public Component, public Tag
+        {
+        public:
+            explicit TaggedListener(Component* parent)
+                : Component{parent}
+                , Tag{}
+                , values{}
+            {
+            }
+
+            virtual void handle_number(const Number& message)
+            {
+                values.push_back(message.value);
+            }
+
+            std::vector<std::uint32_t> values;
+        };
+
+        /// @brief Overrides the handler of @ref TaggedListener.
+        class DoublingListener : public TaggedListener
+        {
+        public:
+            using TaggedListener::TaggedListener;
+
+            void handle_number(const Number& message) override
+            {
+                values.push_back(message.value * 2 + tag);
+            }
+        };
+
+        using Bus = MessageBus<Number, Text>;
+    }  // namespace
+
+    /// @brief Test the grouping of subscribers per event loop.
+    ///
+    /// @details
+    /// The test succeeds if subscribers sharing an event loop are grouped in a single destination and receive the
+    /// messages in subscription order.
+    TEST(BaseTest, MessageBusSameLoop)
+    {
+        Root root{};
+        Bus bus{&root};
+        Listener listener_a{&root};
+        Listener listener_b{&root};
+        std::vector<std::string> texts{};
+
+        bus.subscribe(&listener_a, &Listener::handle_number);
+        bus.subscribe(&listener_b, &Listener::handle_number);
+        bus.subscribe<Text>(&listener_a,
+                            [&texts](const Text& message)
+                            {
+                                texts.push_back("a" + message.value);
+                            });
+        bus.subscribe<Text>(&listener_b,
+                            [&texts, &root](const Text& message)
+                            {
+                                texts.push_back("b" + message.value);
+                                root.stop();
+                            });
+
+        EXPECT_EQ(bus.subscribers<Number>(), 2);
+        EXPECT_EQ(bus.destinations<Number>(), 1);
+        EXPECT_EQ(bus.destinations<Text>(), 1);
+
+        bus.publish(Number{1});
+        bus.publish(Number{2});
+        bus.publish(Text{"x"});
+
+        root.run();
+
+        EXPECT_EQ(listener_a.numbers, (std::vector<std::uint32_t>{1, 2}));
+        EXPECT_EQ(listener_b.numbers, (std::vector<std::uint32_t>{1, 2}));
+        EXPECT_EQ(texts, (std::vector<std::string>{"ax", "bx"}));
+    }
+
+    /// @brief Test the delivery of messages to subscribers in several event loops.
+    ///
+    /// @details
+    /// The test succeeds if each handler is invoked from the thread of its subscriber.
+    TEST(BaseTest, MessageBusBranches)
+    {
+        Root root{};
+        Bus bus{&root};
+        Branch<Listener> branch_a{&root};
+        Branch<Listener> branch_b{&root};
+        Listener extra_b{&branch_b.component()};
+
+        bus.subscribe(&branch_a.component(), &Listener::handle_number);
+        bus.subscribe(&branch_b.component(), &Listener::handle_number);
+        bus.subscribe(&extra_b, &Listener::handle_number);
+
+        EXPECT_EQ(bus.subscribers<Number>(), 3);
+        EXPECT_EQ(bus.destinations<Number>(), 2);
+        EXPECT_EQ(bus.subscribers<Text>(), 0);
+
+        branch_a.run();
+        branch_b.run();
+
+        for (std::uint32_t i = 0; i < 10; i++)
+        {
+            bus.publish(Number{i});
+        }
+
+        for (auto* listener : {&branch_a.component(), &branch_b.component(), &extra_b})
+        {
+            while (listener->received() < 10)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        std::vector<std::uint32_t> expected{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        EXPECT_EQ(branch_a.component().numbers, expected);
+        EXPECT_EQ(branch_b.component().numbers, expected);
+        EXPECT_EQ(extra_b.numbers, expected);
+        EXPECT_THAT(branch_a.component().threads, testing::Each(testing::Ne(std::this_thread::get_id())));
+        EXPECT_THAT(branch_a.component().threads, testing::Each(testing::Ne(extra_b.threads.front())));
+        EXPECT_EQ(branch_b.component().threads, extra_b.threads);
+    }
+
+    /// @brief Test subscribing methods alongside handlers.
+    ///
+    /// @details
+    /// The test succeeds if methods are invoked on the right object (including virtual overrides and methods of a
+    /// secondary base), interleaved with handlers in subscription order.
+    TEST(BaseTest, MessageBusMethods)
+    {
+        Root root{};
+        Bus bus{&root};
+        TaggedListener tagged{&root};
+        DoublingListener doubling{&root};
+        std::vector<std::uint32_t> order{};
+
+        bus.subscribe(&tagged, &TaggedListener::handle_number);
+        bus.subscribe<Number>(&root,
+                              [&order, &tagged, &doubling](const Number&)
+                              {
+                                  order.push_back(static_cast<std::uint32_t>(tagged.values.size()));
+                                  order.push_back(static_cast<std::uint32_t>(doubling.values.size()));
+                              });
+        bus.subscribe<TaggedListener, Number>(&doubling, &TaggedListener::handle_number);
+        bus.subscribe<TaggedListener, Number>(&tagged, &Tag::handle_tagged);
+
+        EXPECT_EQ(bus.subscribers<Number>(), 4);
+        EXPECT_EQ(bus.destinations<Number>(), 1);
+
+        bus.publish(Number{1});
+        bus.publish(Number{5});
+
+        root.post(
+            [&root]()
+            {
+                root.stop();
+            });
+        root.run();
+
+        EXPECT_EQ(tagged.values, (std::vector<std::uint32_t>{1, 5}));
+        EXPECT_EQ(doubling.values, (std::vector<std::uint32_t>{9, 17}));
+        EXPECT_EQ(tagged.tagged, (std::vector<std::uint32_t>{8, 12}));
+        EXPECT_TRUE(doubling.tagged.empty());
+        EXPECT_EQ(order, (std::vector<std::uint32_t>{1, 0, 2, 1}));
+    }
+
+    /// @brief Test removing subscriptions.
+    TEST(BaseTest, MessageBusUnsubscribe)
+    {
+        Root root{};
+        Bus bus{&root};
+        Listener listener_a{&root};
+        Listener listener_b{&root};
+
+        bus.subscribe(&listener_a, &Listener::handle_number);
+        bus.subscribe(&listener_b, &Listener::handle_number);
+
+        bus.publish(Number{1});
+
+        EXPECT_EQ(bus.unsubscribe<Number>(&listener_a), 1);
+        EXPECT_EQ(bus.unsubscribe<Number>(&listener_a), 0);
+        EXPECT_EQ(bus.subscribers<Number>(), 1);
+
+        bus.publish(Number{2});
+
+        EXPECT_EQ(bus.unsubscribe<Number>(&listener_b), 1);
+        EXPECT_EQ(bus.destinations<Number>(), 0);
+
+        // Publishing without subscribers has no effect
+        bus.publish(Number{3});
+
+        root.post(
+            [&root]()
+            {
+                root.stop();
+            });
+        root.run();
+
+        // Pending deliveries are not cancelled
+        EXPECT_EQ(listener_a.numbers, (std::vector<std::uint32_t>{1}));
+        EXPECT_EQ(listener_b.numbers, (std::vector<std::uint32_t>{1, 2}));
+    }
+}  // namespace kouta::tests::base
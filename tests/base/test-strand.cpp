@@ -0,0 +1,209 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/callback/deferred-callback.hpp>
+#include <kouta/base/component-handle.hpp>
+#include <kouta/base/message-bus.hpp>
+#include <kouta/base/root.hpp>
+
+namespace kouta::tests::base
+{
+    using namespace kouta::base;
+
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        /// Number of threads running the event loop.
+        constexpr std::size_t ThreadCount{4};
+
+        /// @brief Component that tracks how many of its events are executed concurrently.
+        class Worker : public Component
+        {
+        public:
+            Worker(Component* parent, bool serialized, std::chrono::microseconds patience = 100us)
+                : Component{parent}
+                , handled{0}
+                , max_in_flight{0}
+                , m_in_flight{0}
+                , m_patience{patience}
+            {
+                if (serialized)
+                {
+                    enable_strand();
+                }
+            }
+
+            /// @brief Handle an event, waiting until @p target events have been in flight (or the patience runs out).
+            void handle_event(std::uint32_t target)
+            {
+                auto in_flight{m_in_flight.fetch_add(1, std::memory_order_acq_rel) + 1};
+                auto expected{max_in_flight.load(std::memory_order_relaxed)};
+
+                while (in_flight > expected && !max_in_flight.compare_exchange_weak(expected, in_flight))
+                {
+                }
+
+                auto timeout{std::chrono::steady_clock::now() + m_patience};
+
+                while (max_in_flight.load(std::memory_order_acquire) < target
+                       && std::chrono::steady_clock::now() < timeout)
+                {
+                    std::this_thread::yield();
+                }
+
+                handled++;
+
+                m_in_flight.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            /// @brief Handle a message published through a bus.
+            void handle_message(const std::uint32_t& target)
+            {
+                handle_event(target);
+            }
+
+            /// @brief Make the opt-out available to the tests.
+            using Component::disable_strand;
+
+            std::atomic<std::uint32_t> handled;
+            std::atomic<std::uint32_t> max_in_flight;
+
+        private:
+            std::atomic<std::uint32_t> m_in_flight;
+            std::chrono::microseconds m_patience;
+        };
+
+        /// @brief Run the event loop of a root from several threads until the @p done condition holds.
+        template<class TDone>
+        void run_parallel(Root& root, TDone&& done)
+        {
+            std::vector<std::thread> threads{};
+
+            for (std::size_t i = 0; i < ThreadCount; i++)
+            {
+                threads.emplace_back(
+                    [&root]()
+                    {
+                        root.run();
+                    });
+            }
+
+            auto timeout{std::chrono::steady_clock::now() + 10s};
+
+            while (!done() && std::chrono::steady_clock::now() < timeout)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+
+            root.stop();
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }  // namespace
+
+    /// @brief Test the events of a component with a strand while the event loop runs in several threads.
+    ///
+    /// @details
+    /// Events are posted directly, through a deferred callback, a handle and a message bus. The test succeeds if they
+    /// are never executed concurrently, including those of a child, which shares the strand of its parent.
+    TEST(BaseTest, StrandSerialized)
+    {
+        Root root{};
+        Worker worker{&root, true};
+        Worker child{&worker, false};
+        callback::DeferredCallback<std::uint32_t> callback{&worker, &Worker::handle_event};
+        ComponentHandle handle{&worker};
+        MessageBus<std::uint32_t> bus{&root};
+
+        ASSERT_TRUE(worker.strand());
+        EXPECT_EQ(child.strand(), worker.strand());
+        EXPECT_FALSE(root.strand());
+
+        bus.subscribe(&worker, &Worker::handle_message);
+        bus.subscribe(&child, &Worker::handle_message);
+
+        // Both subscribers share a single delivery
+        EXPECT_EQ(bus.destinations<std::uint32_t>(), 1);
+
+        for (std::uint32_t i = 0; i < 100; i++)
+        {
+            worker.post(&Worker::handle_event, ThreadCount);
+            child.post(&Worker::handle_event, ThreadCount);
+            callback(ThreadCount);
+            handle.post(&Worker::handle_event, ThreadCount);
+            bus.publish(static_cast<std::uint32_t>(ThreadCount));
+        }
+
+        run_parallel(root,
+                     [&worker, &child]()
+                     {
+                         return worker.max_in_flight + child.max_in_flight > 2 || worker.handled + child.handled == 600;
+                     });
+
+        EXPECT_EQ(worker.max_in_flight, 1);
+        EXPECT_EQ(child.max_in_flight, 1);
+        EXPECT_EQ(worker.handled + child.handled, 600);
+    }
+
+    /// @brief Test the events of a component without a strand while the event loop runs in several threads.
+    ///
+    /// @details
+    /// The test succeeds if the events are executed in parallel in all the threads.
+    TEST(BaseTest, StrandParallel)
+    {
+        Root root{};
+        Worker worker{&root, false, 5s};
+        std::atomic<std::uint32_t> done{0};
+
+        EXPECT_FALSE(worker.strand());
+
+        for (std::uint32_t i = 0; i < ThreadCount; i++)
+        {
+            worker.post(
+                [&worker, &done]()
+                {
+                    worker.handle_event(ThreadCount);
+                    done++;
+                });
+        }
+
+        run_parallel(root,
+                     [&done]()
+                     {
+                         return done == ThreadCount;
+                     });
+
+        EXPECT_EQ(worker.max_in_flight, ThreadCount);
+    }
+
+    /// @brief Test opting out of the strand of the parent.
+    ///
+    /// @details
+    /// The test succeeds if children created after the opt-out, as well as nested roots, do not use the strand.
+    TEST(BaseTest, StrandOptOut)
+    {
+        Root root{};
+        Worker worker{&root, true};
+        Root nested{&worker};
+        Worker child{&worker, false};
+
+        child.disable_strand();
+
+        Worker grandchild{&child, false};
+
+        EXPECT_TRUE(worker.strand());
+        EXPECT_FALSE(nested.strand());
+        EXPECT_FALSE(child.strand());
+        EXPECT_FALSE(grandchild.strand());
+    }
+}  // namespace kouta::tests::base
@@ -0,0 +1,177 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/bit-packer.hpp>
+#include <kouta/io/bit-parser.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// @brief Pack random fields of every width and parse them back.
+        template<BitOrder Order>
+        void test_bits_round_trip()
+        {
+            std::mt19937_64 gen{42};
+            std::vector<std::pair<std::uint64_t, std::size_t>> fields{};
+
+            for (std::size_t round = 0; round < 4; round++)
+            {
+                for (std::size_t count = 1; count <= 64; count++)
+                {
+                    std::uint64_t mask{(count == 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << count) - 1)};
+
+                    fields.emplace_back(gen() & mask, count);
+                }
+            }
+
+            Packer packer{};
+            BitPacker<Order> bit_packer{packer};
+            std::size_t total{0};
+
+            for (const auto& [value, count] : fields)
+            {
+                bit_packer.insert_bits(value, count);
+                total += count;
+            }
+
+            bit_packer.align();
+
+            ASSERT_EQ(bit_packer.pending(), 0);
+            ASSERT_EQ(packer.size(), (total + 7) / 8);
+
+            BitParser<Order> parser{Parser{packer.data()}};
+            std::size_t offset{0};
+
+            for (const auto& [value, count] : fields)
+            {
+                ASSERT_EQ(parser.extract_bits(offset, count), value);
+                offset += count;
+            }
+        }
+    }  // namespace
+
+    /// @brief Test the layout of bit fields (MSB first).
+    ///
+    /// @details
+    /// The test succeeds if the packed bytes match the expected ones and fields can be extracted.
+    TEST(IoTest, BitsMsbFirst)
+    {
+        Packer packer{};
+        BitPacker<BitOrder::msb_first> bit_packer{packer};
+
+        // 101 | 1010 1011 1100 | 1 | (padding) 0000 000
+        bit_packer.insert_bits(std::uint8_t{0b101}, 3);
+        bit_packer.insert_bits(std::uint16_t{0xABC}, 12);
+        bit_packer.insert_bit(true);
+        bit_packer.insert_bits(std::int8_t{-2}, 3);
+        bit_packer.align();
+
+        std::vector<std::uint8_t> buf{0xB5, 0x79, 0xC0};
+
+        ASSERT_EQ(packer.data(), buf);
+
+        BitParser<BitOrder::msb_first> parser{Parser{buf}};
+
+        ASSERT_EQ(parser.bit_size(), 24);
+        ASSERT_EQ(parser.extract_bits(0, 3), 0b101);
+        ASSERT_EQ(parser.extract_bits<std::uint16_t>(3, 12), std::uint16_t{0xABC});
+        ASSERT_EQ(parser.extract_bit(15), true);
+        ASSERT_EQ(parser.extract_bits<std::int8_t>(16, 3), std::int8_t{-2});
+        ASSERT_EQ(parser.extract_bits<std::uint8_t>(16, 3), std::uint8_t{0b110});
+    }
+
+    /// @brief Test the layout of bit fields (LSB first).
+    ///
+    /// @details
+    /// The test succeeds if the packed bytes match the expected ones and fields can be extracted.
+    TEST(IoTest, BitsLsbFirst)
+    {
+        Packer packer{};
+        BitPacker<BitOrder::lsb_first> bit_packer{packer};
+
+        bit_packer.insert_bits(std::uint8_t{0b101}, 3);
+        bit_packer.insert_bits(std::uint16_t{0xABC}, 12);
+        bit_packer.insert_bit(true);
+        bit_packer.insert_bits(std::int8_t{-2}, 3);
+        bit_packer.align();
+
+        // 0b101 | 0xABC << 3 | 1 << 15 | 0b110 << 16
+        std::vector<std::uint8_t> buf{0xE5, 0xD5, 0x06};
+
+        ASSERT_EQ(packer.data(), buf);
+
+        BitParser<BitOrder::lsb_first> parser{Parser{buf}};
+
+        ASSERT_EQ(parser.extract_bits(0, 3), 0b101);
+        ASSERT_EQ(parser.extract_bits<std::uint16_t>(3, 12), std::uint16_t{0xABC});
+        ASSERT_EQ(parser.extract_bit(15), true);
+        ASSERT_EQ(parser.extract_bits<std::int8_t>(16, 3), std::int8_t{-2});
+    }
+
+    /// @brief Test packing and parsing fields of every width, crossing 64-bit boundaries.
+    ///
+    /// @details
+    /// The test succeeds if all fields can be extracted back.
+    TEST(IoTest, BitsRoundTrip)
+    {
+        test_bits_round_trip<BitOrder::msb_first>();
+        test_bits_round_trip<BitOrder::lsb_first>();
+    }
+
+    /// @brief Test mixing bit fields and byte-aligned fields.
+    ///
+    /// @details
+    /// The test succeeds if the byte-level and bit-level fields can be extracted at their aligned offsets.
+    TEST(IoTest, BitsByteInterop)
+    {
+        Packer packer{};
+        BitPacker bit_packer{packer};
+
+        packer.insert_integral(std::uint16_t{0xCAFE});
+        bit_packer.insert_bits(std::uint8_t{0b11}, 2);
+        bit_packer.insert_bits(std::uint8_t{0b0}, 1);
+        bit_packer.align();
+        packer.insert_integral(std::uint32_t{0xDEADBEEF});
+        bit_packer.insert_bits(std::uint16_t{0x3FF}, 10);
+        bit_packer.align();
+
+        ASSERT_EQ(packer.size(), 2 + 1 + 4 + 2);
+
+        Parser parser{packer.data()};
+
+        ASSERT_EQ(parser.extract_integral<std::uint16_t>(0), std::uint16_t{0xCAFE});
+        ASSERT_EQ(parser.extract_integral<std::uint32_t>(3), std::uint32_t{0xDEADBEEF});
+
+        BitParser flags{parser.extract_bytes(2, 1)};
+
+        ASSERT_EQ(flags.extract_bits(0, 2), 0b11);
+        ASSERT_EQ(flags.extract_bit(2), false);
+
+        BitParser tail{parser.extract_bytes(7, 2)};
+
+        ASSERT_EQ(tail.extract_bits(0, 10), 0x3FF);
+    }
+
+    /// @brief Test the behaviour of the bit parser when attempting to extract a field out of bounds.
+    ///
+    /// @details
+    /// The test succeeds if an exception is thrown.
+    TEST(IoTest, BitsBoundCheck)
+    {
+        std::vector<std::uint8_t> buf{0xFF, 0xFF};
+        BitParser parser{Parser{buf}};
+        Packer packer{};
+        BitPacker bit_packer{packer};
+
+        ASSERT_THROW(parser.extract_bits(10, 7), std::out_of_range);
+        ASSERT_THROW(parser.extract_bits(0, 65), std::invalid_argument);
+        ASSERT_THROW(bit_packer.insert_bits(0, 65), std::invalid_argument);
+    }
+}  // namespace kouta::tests::io
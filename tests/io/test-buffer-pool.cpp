@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/buffer-pool.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+
+    /// @brief Test allocating blocks from the pool.
+    ///
+    /// @details
+    /// The test succeeds if blocks are aligned, do not overlap, and the pool grows by chunks.
+    TEST(IoTest, BufferPoolAllocate)
+    {
+        BufferPool pool{100, 8};
+
+        ASSERT_EQ(pool.block_size(), 128);
+        ASSERT_EQ(pool.capacity(), 0);
+
+        std::vector<BufferSlice> slices{};
+        std::set<const std::uint8_t*> addresses{};
+
+        for (std::size_t i = 0; i < 20; i++)
+        {
+            slices.push_back(pool.allocate());
+
+            const auto& slice{slices.back()};
+
+            ASSERT_EQ(slice.size(), pool.block_size());
+            ASSERT_EQ(slice.use_count(), 1);
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(slice.view().data()) % 64, 0);
+
+            std::fill(slice.data().begin(), slice.data().end(), static_cast<std::uint8_t>(i));
+            addresses.insert(slice.view().data());
+        }
+
+        ASSERT_EQ(addresses.size(), 20);
+        ASSERT_EQ(pool.capacity(), 24);
+
+        for (std::size_t i = 0; i < 20; i++)
+        {
+            ASSERT_TRUE(std::ranges::all_of(
+                slices[i].view(),
+                [i](std::uint8_t b)
+                {
+                    return b == i;
+                }));
+        }
+    }
+
+    /// @brief Test sharing and splitting slices.
+    ///
+    /// @details
+    /// The test succeeds if slices share the same block and the block is reused once all of them are destroyed.
+    TEST(IoTest, BufferPoolSlices)
+    {
+        BufferPool pool{64, 4};
+
+        auto slice{pool.allocate()};
+        const auto* block{slice.view().data()};
+
+        slice.data()[10] = 0xAB;
+
+        {
+            auto copy{slice};
+            auto sub{slice.subslice(10, 20)};
+            auto moved{std::move(copy)};
+
+            ASSERT_EQ(slice.use_count(), 3);
+            ASSERT_TRUE(copy.empty());
+            ASSERT_EQ(copy.use_count(), 0);
+            ASSERT_EQ(sub.size(), 20);
+            ASSERT_EQ(sub.parser().extract_integral<std::uint8_t>(0), 0xAB);
+            ASSERT_EQ(sub.view().data(), block + 10);
+
+            ASSERT_THROW(sub.subslice(10, 11), std::out_of_range);
+            ASSERT_THROW(sub.subslice(21, 0), std::out_of_range);
+        }
+
+        ASSERT_EQ(slice.use_count(), 1);
+
+        auto tail{slice.split(16)};
+
+        ASSERT_EQ(slice.size(), 16);
+        ASSERT_EQ(tail.size(), 48);
+        ASSERT_EQ(tail.view().data(), block + 16);
+        ASSERT_EQ(slice.use_count(), 2);
+
+        slice = BufferSlice{};
+        tail = slice;
+
+        ASSERT_EQ(tail.use_count(), 0);
+
+        // Released block is handed out again
+        auto reused{pool.allocate()};
+
+        ASSERT_EQ(reused.view().data(), block);
+        ASSERT_EQ(pool.capacity(), 4);
+    }
+
+    /// @brief Test releasing slices from other threads.
+    ///
+    /// @details
+    /// The test succeeds if blocks released by consumer threads are reused by the producer, without growing the pool.
+    TEST(IoTest, BufferPoolThreads)
+    {
+        BufferPool pool{256, 16};
+
+        for (std::size_t round = 0; round < 50; round++)
+        {
+            std::vector<BufferSlice> slices{};
+
+            for (std::size_t i = 0; i < 16; i++)
+            {
+                slices.push_back(pool.allocate());
+                slices.back().data()[0] = static_cast<std::uint8_t>(i);
+            }
+
+            std::thread consumer{[slices = std::move(slices)]() mutable
+                                 {
+                                     for (std::size_t i = 0; i < slices.size(); i++)
+                                     {
+                                         EXPECT_EQ(slices[i].view()[0], i);
+                                     }
+
+                                     slices.clear();
+                                 }};
+
+            consumer.join();
+        }
+
+        // Free lists of the consumer threads are returned to the pool when they exit
+        ASSERT_LE(pool.capacity(), 32);
+    }
+
+    /// @brief Test that the free lists of pools destroyed from other threads are discarded.
+    ///
+    /// @details
+    /// A long-lived thread uses several pools that are destroyed from other threads. The test succeeds if the thread
+    /// only keeps the free list of the pool in use once it starts using a new one.
+    TEST(IoTest, BufferPoolStaleCaches)
+    {
+        std::thread worker{[]()
+                           {
+                               std::vector<BufferPool*> pools{};
+
+                               for (std::size_t i = 0; i < 10; i++)
+                               {
+                                   pools.push_back(new BufferPool{64});
+
+                                   // Released to the free list of this thread
+                                   pools.back()->allocate();
+                               }
+
+                               std::thread{[&pools]()
+                                           {
+                                               for (auto* pool : pools)
+                                               {
+                                                   delete pool;
+                                               }
+                                           }}
+                                   .join();
+
+                               EXPECT_EQ(BufferPool::thread_cache_count(), 10);
+
+                               BufferPool pool{64};
+                               pool.allocate();
+
+                               EXPECT_EQ(BufferPool::thread_cache_count(), 1);
+                           }};
+
+        worker.join();
+    }
+
+    /// @brief Test slices that outlive the thread that allocated them.
+    ///
+    /// @details
+    /// One slice is kept by another thread, and another one is held by a thread-local object that is destroyed after
+    /// the free lists of its thread. The test succeeds if both blocks are returned to the pool (so that it does not
+    /// grow), without accessing the destroyed free lists (which is detected when running with AddressSanitizer).
+    TEST(IoTest, BufferPoolThreadExit)
+    {
+        constexpr std::size_t ChunkSize{4};
+
+        BufferPool pool{64, ChunkSize};
+        BufferSlice kept{};
+
+        std::thread producer{[&pool, &kept]()
+                             {
+                                 // Constructed before the free lists of the thread, hence destroyed after them
+                                 thread_local BufferSlice late{};
+
+                                 late = pool.allocate();
+                                 kept = pool.allocate();
+                             }};
+
+        producer.join();
+
+        ASSERT_EQ(kept.use_count(), 1);
+        ASSERT_EQ(pool.capacity(), ChunkSize);
+
+        kept = BufferSlice{};
+
+        std::vector<BufferSlice> slices{};
+
+        for (std::size_t i = 0; i < ChunkSize; i++)
+        {
+            slices.push_back(pool.allocate());
+        }
+
+        ASSERT_EQ(pool.capacity(), ChunkSize);
+    }
+}  // namespace kouta::tests::io
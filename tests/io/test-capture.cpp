@@ -0,0 +1,266 @@
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/capture.hpp>
+#include <kouta/io/packer.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// @brief Obtain a unique path for a temporary file.
+        std::filesystem::path temp_path(const std::string& name)
+        {
+            return std::filesystem::temp_directory_path() / ("kouta-" + name + "-" + std::to_string(::getpid()));
+        }
+
+        /// @brief Write a capture with `count` blocks, with timestamps `i * 10` and a payload holding `i`.
+        void write_capture(const std::filesystem::path& path, std::uint32_t count, std::size_t index_interval)
+        {
+            capture::Writer writer{path, index_interval};
+
+            for (std::uint32_t i = 0; i < count; i++)
+            {
+                Packer payload{};
+
+                payload.insert_integral<std::uint32_t>(i);
+                payload.insert_string(std::string(i % 50, 'x'));
+
+                writer.append(i * 10, payload.data(), i % 2);
+            }
+
+            ASSERT_EQ(writer.blocks(), count);
+        }
+    }  // namespace
+
+    /// @brief Test writing and reading a capture.
+    ///
+    /// @details
+    /// The test succeeds if all the blocks are read back in order, with their timestamps, flags and payloads.
+    TEST(IoTest, CaptureReadWrite)
+    {
+        auto path{temp_path("capture")};
+
+        write_capture(path, 1000, 256);
+
+        capture::Reader reader{path};
+
+        ASSERT_TRUE(reader.indexed());
+        ASSERT_GT(reader.index().size(), 10);
+        ASSERT_LT(reader.index().size(), 1000);
+
+        std::uint32_t expected{0};
+
+        reader.replay(
+            reader.range(),
+            [&expected](const capture::Record& record)
+            {
+                ASSERT_EQ(record.timestamp, expected * 10);
+                ASSERT_EQ(record.flags, expected % 2);
+                ASSERT_EQ(record.payload.extract_integral<std::uint32_t>(0), expected);
+                ASSERT_EQ(record.payload.size(), 4 + expected % 50);
+
+                expected++;
+            });
+
+        ASSERT_EQ(expected, 1000);
+
+        std::size_t offset{reader.range().end};
+
+        ASSERT_FALSE(reader.read(offset).has_value());
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Test writing blocks with invalid timestamps.
+    ///
+    /// @details
+    /// The test succeeds if decreasing timestamps are rejected, and blocks cannot be appended once finished.
+    TEST(IoTest, CaptureInvalidTimestamp)
+    {
+        auto path{temp_path("capture-invalid")};
+
+        {
+            capture::Writer writer{path};
+            const std::uint8_t payload[]{0x01};
+
+            writer.append(10, payload);
+            writer.append(10, payload);
+
+            ASSERT_THROW(writer.append(9, payload), std::invalid_argument);
+
+            writer.finish();
+
+            ASSERT_THROW(writer.append(20, payload), std::logic_error);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Test seeking by timestamp.
+    ///
+    /// @details
+    /// The test succeeds if the first block with a timestamp not lower than the requested one is found.
+    TEST(IoTest, CaptureSeek)
+    {
+        auto path{temp_path("capture-seek")};
+
+        write_capture(path, 1000, 256);
+
+        capture::Reader reader{path};
+
+        for (std::uint64_t timestamp : {0UL, 1UL, 10UL, 4995UL, 5000UL, 9990UL})
+        {
+            auto offset{reader.seek(timestamp)};
+            auto record{reader.read(offset)};
+
+            ASSERT_TRUE(record.has_value());
+            ASSERT_EQ(record->timestamp, ((timestamp + 9) / 10) * 10);
+        }
+
+        ASSERT_EQ(reader.seek(9991), reader.range().end);
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Test seeking over blocks sharing the same timestamp.
+    ///
+    /// @details
+    /// The test succeeds if the seek lands on the first block with said timestamp, even if it is not indexed.
+    TEST(IoTest, CaptureSeekDuplicates)
+    {
+        auto path{temp_path("capture-duplicates")};
+
+        {
+            capture::Writer writer{path, 1};
+            const std::uint8_t payload[]{0x01};
+
+            writer.append(1, payload);
+
+            for (std::size_t i = 0; i < 10; i++)
+            {
+                writer.append(5, payload);
+            }
+        }
+
+        capture::Reader reader{path};
+
+        ASSERT_EQ(reader.seek(5), capture::FileHeaderSize + capture::BlockHeaderSize + 1);
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Test splitting a capture for parallel replay.
+    ///
+    /// @details
+    /// The test succeeds if the ranges are consecutive, and replaying them from several threads reads all the blocks.
+    TEST(IoTest, CaptureSplit)
+    {
+        auto path{temp_path("capture-split")};
+
+        write_capture(path, 1000, 256);
+
+        capture::Reader reader{path};
+        auto ranges{reader.split(4)};
+
+        ASSERT_EQ(ranges.size(), 4);
+        ASSERT_EQ(ranges.front().begin, reader.range().begin);
+        ASSERT_EQ(ranges.back().end, reader.range().end);
+
+        for (std::size_t i = 1; i < ranges.size(); i++)
+        {
+            ASSERT_EQ(ranges[i].begin, ranges[i - 1].end);
+        }
+
+        std::vector<std::size_t> counts(ranges.size(), 0);
+        std::vector<std::thread> threads{};
+
+        for (std::size_t i = 0; i < ranges.size(); i++)
+        {
+            threads.emplace_back(
+                [&reader, &ranges, &counts, i]()
+                {
+                    reader.replay(
+                        ranges[i],
+                        [&counts, i](const capture::Record&)
+                        {
+                            counts[i]++;
+                        });
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(counts[0] + counts[1] + counts[2] + counts[3], 1000);
+
+        // Small captures yield fewer ranges
+        ASSERT_EQ(reader.split(1).size(), 1);
+        ASSERT_LE(reader.split(100000).size(), reader.index().size());
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Test reading a capture lacking the index.
+    ///
+    /// @details
+    /// The test succeeds if the index is rebuilt and corrupted blocks are detected.
+    TEST(IoTest, CaptureRecovery)
+    {
+        auto path{temp_path("capture-recovery")};
+
+        write_capture(path, 100, 256);
+
+        std::size_t end{0};
+
+        {
+            capture::Reader reader{path};
+
+            end = reader.range().end;
+        }
+
+        // Drop the index and trailer
+        std::filesystem::resize_file(path, end);
+
+        {
+            capture::Reader reader{path};
+
+            ASSERT_FALSE(reader.indexed());
+            ASSERT_EQ(reader.range().end, end);
+
+            auto offset{reader.seek(500)};
+
+            ASSERT_EQ(reader.read(offset)->timestamp, 500);
+        }
+
+        // Corrupt the payload of the first block
+        {
+            MappedFile file{path, MappedFile::Mode::ReadWrite};
+
+            file.data()[capture::FileHeaderSize + capture::BlockHeaderSize] ^= 0xFF;
+        }
+
+        {
+            capture::Reader reader{path};
+            auto offset{reader.range().begin};
+
+            ASSERT_THROW(reader.read(offset), std::runtime_error);
+        }
+
+        std::filesystem::remove(path);
+
+        ASSERT_THROW(capture::Reader{path}, std::system_error);
+    }
+}  // namespace kouta::tests::io
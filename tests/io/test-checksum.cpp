@@ -0,0 +1,144 @@
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/checksum.hpp>
+#include <kouta/io/packer.hpp>
+#include <kouta/io/parser.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// Standard check input.
+        constexpr std::string_view CheckInput{"123456789"};
+
+        std::span<const std::uint8_t> check_view()
+        {
+            return {reinterpret_cast<const std::uint8_t*>(CheckInput.data()), CheckInput.size()};
+        }
+
+        std::vector<std::uint8_t> random_bytes(std::size_t count)
+        {
+            std::mt19937 gen{42};
+            std::vector<std::uint8_t> result(count);
+
+            for (auto& b : result)
+            {
+                b = static_cast<std::uint8_t>(gen());
+            }
+
+            return result;
+        }
+
+        /// @brief Compute the checksum of the data in two chunks.
+        template<checksum::Algorithm TAlgorithm>
+        typename TAlgorithm::Value compute_chunked(std::span<const std::uint8_t> view, std::size_t split)
+        {
+            return TAlgorithm::compute(view.subspan(split), TAlgorithm::compute(view.first(split)));
+        }
+    }  // namespace
+
+    /// @brief Test the checksums of the standard check input.
+    ///
+    /// @details
+    /// The test succeeds if all checksums match the reference values.
+    TEST(IoTest, ChecksumCheckValues)
+    {
+        ASSERT_EQ(checksum::Crc32::compute(check_view()), 0xCBF43926);
+        ASSERT_EQ(checksum::Crc32c::compute(check_view()), 0xE3069283);
+        ASSERT_EQ(checksum::Crc16::compute(check_view()), 0x29B1);
+        ASSERT_EQ(checksum::Adler32::compute(check_view()), 0x091E01DE);
+
+        ASSERT_EQ(checksum::Crc32::compute({}), 0);
+        ASSERT_EQ(checksum::Crc32c::compute({}), 0);
+        ASSERT_EQ(checksum::Crc16::compute({}), 0xFFFF);
+        ASSERT_EQ(checksum::Adler32::compute({}), 1);
+    }
+
+    /// @brief Test that the accelerated implementations match the portable ones.
+    ///
+    /// @details
+    /// The test succeeds if all implementations produce the same results for every length and alignment.
+    TEST(IoTest, ChecksumImplementations)
+    {
+        auto data{random_bytes(4096 + 16)};
+
+        for (std::size_t offset = 0; offset < 16; offset += 3)
+        {
+            for (std::size_t count : {0, 1, 7, 8, 15, 16, 63, 64, 65, 127, 128, 200, 1000, 4096})
+            {
+                std::span<const std::uint8_t> view{data.data() + offset, count};
+
+                ASSERT_EQ(
+                    checksum::Crc32::compute(view), ~checksum::detail::crc32_portable(~0U, view.data(), view.size()));
+                ASSERT_EQ(
+                    checksum::Crc32c::compute(view),
+                    ~checksum::detail::crc32c_portable(~0U, view.data(), view.size()));
+            }
+        }
+    }
+
+    /// @brief Test computing checksums incrementally.
+    ///
+    /// @details
+    /// The test succeeds if computing the checksum in chunks produces the same result as computing it at once.
+    TEST(IoTest, ChecksumChunked)
+    {
+        auto data{random_bytes(1000)};
+        std::span<const std::uint8_t> view{data};
+
+        for (std::size_t split : {0, 1, 9, 64, 500, 999, 1000})
+        {
+            ASSERT_EQ(compute_chunked<checksum::Crc32>(view, split), checksum::Crc32::compute(view));
+            ASSERT_EQ(compute_chunked<checksum::Crc32c>(view, split), checksum::Crc32c::compute(view));
+            ASSERT_EQ(compute_chunked<checksum::Crc16>(view, split), checksum::Crc16::compute(view));
+            ASSERT_EQ(compute_chunked<checksum::Adler32>(view, split), checksum::Adler32::compute(view));
+        }
+
+        // Long enough for the Adler-32 sums to be reduced several times
+        auto large{random_bytes(100000)};
+
+        ASSERT_EQ(
+            compute_chunked<checksum::Adler32>(std::span<const std::uint8_t>{large}, 12345),
+            checksum::Adler32::compute(large));
+    }
+
+    /// @brief Test appending checksums with the packer and verifying them with the parser.
+    ///
+    /// @details
+    /// The test succeeds if valid checksums are accepted and corrupted data is detected.
+    TEST(IoTest, ChecksumPackerParser)
+    {
+        Packer packer{};
+
+        packer.insert_byte(0x7E);
+        auto crc{packer.reserve<std::uint16_t>()};
+        packer.insert_string("123456789");
+        packer.patch_crc(crc, checksum::Crc16{});
+        packer.append_checksum<checksum::Crc32c>(1);
+        packer.append_checksum<checksum::Adler32, Packer::Order::little>(1);
+
+        ASSERT_EQ(packer.size(), 1 + 2 + 9 + 4 + 4);
+
+        Parser parser{packer.data()};
+
+        ASSERT_EQ(parser.extract_integral<std::uint16_t>(1), 0x29B1);
+        ASSERT_TRUE(parser.verify_checksum<checksum::Crc32c>(1, 11));
+        ASSERT_TRUE((parser.verify_checksum<checksum::Adler32, Parser::Order::little>(1, 15)));
+        ASSERT_FALSE(parser.verify_checksum<checksum::Adler32>(1, 15));
+        ASSERT_THROW(parser.verify_checksum<checksum::Crc32>(1, 16), std::out_of_range);
+
+        // Corrupt the payload
+        packer.data()[5] ^= 0x01;
+
+        ASSERT_NE(parser.extract_integral<std::uint16_t>(1), checksum::Crc16::compute(parser.extract_bytes(3, 9)));
+        ASSERT_FALSE(parser.verify_checksum<checksum::Crc32c>(1, 11));
+    }
+}  // namespace kouta::tests::io
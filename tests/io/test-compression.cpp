@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/capture.hpp>
+#include <kouta/io/compression.hpp>
+#include <kouta/io/packer.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// Codecs to test.
+        constexpr compression::Codec Codecs[]{
+            compression::Codec::None, compression::Codec::Lz4, compression::Codec::Zstd};
+
+        /// @brief Generate a block of repetitive frames.
+        Packer make_block(std::uint32_t frames)
+        {
+            Packer packer{};
+
+            for (std::uint32_t i = 0; i < frames; i++)
+            {
+                packer.insert_integral<std::uint16_t>(0xCAFE);
+                packer.insert_integral<std::uint32_t>(i);
+                packer.insert_string("sensor-reading");
+                packer.insert_floating_point<double>(i * 0.25);
+            }
+
+            return packer;
+        }
+    }  // namespace
+
+    /// @brief Test compressing and decompressing blocks.
+    ///
+    /// @details
+    /// The test succeeds if blocks are restored by the decompressor, and codecs disabled at build time are rejected.
+    TEST(IoTest, CompressionRoundTrip)
+    {
+        compression::Decompressor decompressor{};
+
+        for (auto codec : Codecs)
+        {
+            if (!compression::available(codec))
+            {
+                ASSERT_THROW(compression::Compressor{codec}, std::invalid_argument);
+                ASSERT_THROW(decompressor.decompress(codec, {}, 0), std::invalid_argument);
+
+                continue;
+            }
+
+            compression::Compressor compressor{codec};
+
+            ASSERT_EQ(compressor.codec(), codec);
+
+            // Contexts and buffers are reused between blocks of different sizes
+            for (std::uint32_t frames : {100U, 1000U, 10U, 0U})
+            {
+                auto block{make_block(frames)};
+                auto compressed{compressor.compress(block.data())};
+
+                if (codec != compression::Codec::None && frames >= 100)
+                {
+                    ASSERT_LT(compressed.size(), block.size() / 2);
+                }
+
+                auto parser{decompressor.decompress(codec, compressed, block.size())};
+
+                ASSERT_TRUE(std::ranges::equal(parser.extract_bytes(0, parser.size()), block.data()));
+
+                if (frames > 0)
+                {
+                    ASSERT_EQ(parser.extract_integral<std::uint32_t>(2), 0);
+                }
+            }
+
+            if (codec != compression::Codec::None)
+            {
+                auto block{make_block(100)};
+                std::vector<std::uint8_t> compressed{};
+
+                std::ranges::copy(compressor.compress(block.data()), std::back_inserter(compressed));
+
+                // Size mismatch
+                ASSERT_THROW(decompressor.decompress(codec, compressed, block.size() + 1), std::runtime_error);
+
+                // Truncated data
+                compressed.resize(compressed.size() / 2);
+                ASSERT_THROW(decompressor.decompress(codec, compressed, block.size()), std::runtime_error);
+            }
+        }
+    }
+
+    /// @brief Test compressed capture files.
+    ///
+    /// @details
+    /// The test succeeds if payloads are stored compressed (unless they do not shrink), and replayed decompressed.
+    TEST(IoTest, CompressionCapture)
+    {
+        for (auto codec : Codecs)
+        {
+            if (!compression::available(codec))
+            {
+                continue;
+            }
+
+            auto path{std::filesystem::temp_directory_path() /
+                      ("kouta-compression-" + std::to_string(static_cast<int>(codec)) + "-" +
+                       std::to_string(::getpid()))};
+            std::size_t raw_size{0};
+
+            {
+                capture::Writer writer{path, capture::Writer::DefaultIndexInterval, codec};
+
+                for (std::uint32_t i = 0; i < 50; i++)
+                {
+                    auto block{make_block(i == 0 ? 1 : 100)};
+
+                    writer.append(i, block.data(), 0x42);
+                    raw_size += block.size();
+                }
+
+                ASSERT_THROW(writer.append(50, make_block(1).data(), capture::CodecMask), std::invalid_argument);
+            }
+
+            capture::Reader reader{path};
+
+            if (codec != compression::Codec::None)
+            {
+                ASSERT_LT(reader.range().end - reader.range().begin, raw_size / 2);
+
+                // Tiny payloads are stored uncompressed, the rest are flagged with the codec
+                std::size_t offset{reader.range().begin};
+
+                ASSERT_EQ(reader.read(offset)->flags, 0x42);
+                ASSERT_EQ(reader.read(offset)->flags >> capture::CodecShift, static_cast<std::uint32_t>(codec));
+            }
+
+            std::uint32_t count{0};
+
+            reader.replay(
+                reader.range(),
+                [&count](const capture::Record& record)
+                {
+                    auto block{make_block(count == 0 ? 1 : 100)};
+
+                    auto payload{record.payload.extract_bytes(0, record.payload.size())};
+
+                    ASSERT_EQ(record.flags, 0x42);
+                    ASSERT_TRUE(std::ranges::equal(payload, block.data()));
+
+                    count++;
+                });
+
+            ASSERT_EQ(count, 50);
+
+            std::filesystem::remove(path);
+        }
+    }
+}  // namespace kouta::tests::io
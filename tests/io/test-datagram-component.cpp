@@ -0,0 +1,196 @@
+#if defined(__linux__)
+
+#include <cerrno>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/callback.hpp>
+#include <kouta/base/root.hpp>
+#include <kouta/io/datagram-component.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+    namespace asio = kouta::base::asio;
+
+    namespace
+    {
+        /// @brief Root that owns a sender and a receiver bound to the loopback interface.
+        class DatagramRoot : public base::Root
+        {
+        public:
+            explicit DatagramRoot(bool gro = false)
+                : base::Root{}
+                , sender{this,
+                         base::callback::DirectCallback{this, &DatagramRoot::handle_sender_received},
+                         base::callback::DirectCallback{this, &DatagramRoot::handle_error}}
+                , receiver{this,
+                           base::callback::DirectCallback{this, &DatagramRoot::handle_received},
+                           base::callback::DirectCallback{this, &DatagramRoot::handle_error},
+                           16,
+                           DatagramComponent::DefaultDatagramSize,
+                           gro}
+                , datagrams{}
+                , batches{0}
+                , expected{0}
+                , errors{}
+            {
+                sender.socket().open(asio::ip::udp::v4());
+                receiver.socket().open(asio::ip::udp::v4());
+                receiver.socket().set_option(asio::socket_base::receive_buffer_size{1 << 20});
+                receiver.socket().bind({asio::ip::address_v4::loopback(), 0});
+                sender.socket().bind({asio::ip::address_v4::loopback(), 0});
+            }
+
+            DatagramComponent sender;
+            DatagramComponent receiver;
+            std::vector<std::vector<std::uint8_t>> datagrams;
+            std::size_t batches;
+            std::size_t expected;
+            std::vector<asio::error_code> errors;
+
+        private:
+            void handle_received(std::span<const Datagram> batch)
+            {
+                batches++;
+
+                for (const auto& datagram : batch)
+                {
+                    EXPECT_EQ(datagram.endpoint, sender.socket().local_endpoint());
+                    datagrams.emplace_back(datagram.parser.view().begin(), datagram.parser.view().end());
+                }
+
+                if (datagrams.size() >= expected)
+                {
+                    stop();
+                }
+            }
+
+            void handle_sender_received(std::span<const Datagram>)
+            {
+                FAIL() << "sender received a datagram";
+            }
+
+            void handle_error(const asio::error_code& ec)
+            {
+                errors.push_back(ec);
+            }
+        };
+    }  // namespace
+
+    /// @brief Test sending and receiving datagrams in batches.
+    ///
+    /// @details
+    /// The test succeeds if all datagrams are received in order, in fewer batches than datagrams.
+    TEST(IoTest, DatagramComponentBatches)
+    {
+        DatagramRoot root{};
+
+        root.receiver.start();
+        root.expected = 100;
+
+        for (std::size_t i = 0; i < root.expected; i++)
+        {
+            Packer packer{};
+            packer.insert_integral(static_cast<std::uint32_t>(i));
+            packer.insert_bytes(std::vector<std::uint8_t>(i, 0x42));
+            root.sender.send(root.receiver.socket().local_endpoint(), std::move(packer));
+        }
+
+        // Datagrams are only sent once the event loop runs
+        ASSERT_EQ(root.sender.pending(), root.expected);
+
+        alarm(2);
+        root.run();
+        alarm(0);
+
+        ASSERT_TRUE(root.errors.empty());
+        ASSERT_EQ(root.sender.pending(), 0);
+        ASSERT_EQ(root.datagrams.size(), root.expected);
+        ASSERT_LT(root.batches, root.expected);
+
+        for (std::size_t i = 0; i < root.expected; i++)
+        {
+            Parser parser{root.datagrams[i]};
+
+            ASSERT_EQ(parser.size(), 4 + i);
+            ASSERT_EQ(parser.extract_integral<std::uint32_t>(0), i);
+        }
+    }
+
+    /// @brief Test sending a buffer as several datagrams with GSO, receiving them with and without GRO.
+    ///
+    /// @details
+    /// The test succeeds if the buffer is received as datagrams of the segment size.
+    TEST(IoTest, DatagramComponentSegmentation)
+    {
+        for (bool gro : {false, true})
+        {
+            DatagramRoot root{gro};
+
+            root.receiver.start();
+            root.expected = 10;
+
+            Packer packer{};
+
+            for (std::size_t i = 0; i < root.expected; i++)
+            {
+                // Last segment is shorter
+                packer.insert_bytes(std::vector<std::uint8_t>(i == (root.expected - 1) ? 50 : 100, i));
+            }
+
+            root.sender.send_segmented(root.receiver.socket().local_endpoint(), std::move(packer), 100);
+
+            alarm(2);
+            root.run();
+            alarm(0);
+
+            ASSERT_TRUE(root.errors.empty());
+            ASSERT_EQ(root.datagrams.size(), root.expected);
+
+            for (std::size_t i = 0; i < root.expected; i++)
+            {
+                ASSERT_EQ(root.datagrams[i].size(), i == (root.expected - 1) ? 50 : 100);
+                ASSERT_EQ(root.datagrams[i][0], i);
+            }
+        }
+    }
+
+    /// @brief Test sending a batch in which a datagram cannot be sent.
+    ///
+    /// @details
+    /// The test succeeds if only the oversized datagram is dropped (and reported), while the ones queued after it are
+    /// still sent.
+    TEST(IoTest, DatagramComponentSendError)
+    {
+        DatagramRoot root{};
+
+        root.receiver.start();
+        root.expected = 3;
+
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            Packer packer{};
+            // Above the maximum size of an UDP datagram
+            packer.insert_bytes(std::vector<std::uint8_t>(i == 1 ? 70000 : 10, static_cast<std::uint8_t>(i)));
+            root.sender.send(root.receiver.socket().local_endpoint(), std::move(packer));
+        }
+
+        alarm(2);
+        root.run();
+        alarm(0);
+
+        ASSERT_EQ(root.errors.size(), 1);
+        ASSERT_EQ(root.errors[0], asio::error_code(EMSGSIZE, asio::error::get_system_category()));
+        ASSERT_EQ(root.sender.pending(), 0);
+        ASSERT_EQ(root.datagrams.size(), root.expected);
+        ASSERT_EQ(root.datagrams[0][0], 0);
+        ASSERT_EQ(root.datagrams[1][0], 2);
+        ASSERT_EQ(root.datagrams[2][0], 3);
+    }
+}  // namespace kouta::tests::io
+
+#endif
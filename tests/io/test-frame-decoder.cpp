@@ -0,0 +1,241 @@
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/frame-decoder.hpp>
+#include <kouta/io/packer.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// @brief Feed the data to the decoder in chunks of the given size, collecting the frames as strings.
+        std::vector<std::string> decode_chunked(
+            FrameDecoder& decoder,
+            const std::vector<std::uint8_t>& data,
+            std::size_t chunk)
+        {
+            std::vector<std::string> frames{};
+
+            for (std::size_t offset = 0; offset < data.size(); offset += chunk)
+            {
+                std::size_t count{std::min(chunk, data.size() - offset)};
+
+                decoder.push(FrameDecoder::View{data.data() + offset, count});
+
+                while (auto frame{decoder.next()})
+                {
+                    frames.emplace_back(frame->extract_string_view(0, frame->size()));
+                }
+            }
+
+            return frames;
+        }
+    }  // namespace
+
+    /// @brief Test decoding frames terminated by a delimiter.
+    ///
+    /// @details
+    /// The test succeeds if all frames are decoded regardless of how the stream is split.
+    TEST(IoTest, FrameDecoderDelimiter)
+    {
+        std::string stream{"first\nsecond\n\nthird line\nincomplete"};
+        std::vector<std::uint8_t> data{stream.begin(), stream.end()};
+
+        for (std::size_t chunk : {1, 2, 5, 7, 64})
+        {
+            // Small capacity to force compaction
+            FrameDecoder decoder{FrameDecoder::delimiter('\n'), 8};
+
+            ASSERT_THAT(
+                decode_chunked(decoder, data, chunk),
+                ::testing::ElementsAre("first\n", "second\n", "\n", "third line\n"));
+
+            auto pending{decoder.pending()};
+
+            ASSERT_EQ(std::string(pending.begin(), pending.end()), "incomplete");
+        }
+    }
+
+    /// @brief Test that framing functions resume scanning where they left off.
+    ///
+    /// @details
+    /// The test succeeds if a frame arriving over several reads is scanned once, and scanning restarts at the next
+    /// frame.
+    TEST(IoTest, FrameDecoderResumeScan)
+    {
+        auto delimiter{FrameDecoder::delimiter('\n')};
+        std::vector<std::size_t> resumed{};
+
+        FrameDecoder decoder{[&](const Parser& pending, std::size_t& scanned)
+                             {
+                                 resumed.push_back(scanned);
+                                 return delimiter(pending, scanned);
+                             }};
+
+        for (const std::string chunk : {"long ", "frame ", "over reads\nnext", "\n"})
+        {
+            decoder.push(FrameDecoder::View{reinterpret_cast<const std::uint8_t*>(chunk.data()), chunk.size()});
+
+            while (decoder.next())
+            {
+            }
+        }
+
+        ASSERT_THAT(resumed, ::testing::ElementsAre(0, 5, 11, 0, 4));
+        ASSERT_TRUE(decoder.pending().empty());
+    }
+
+    /// @brief Test decoding frames with a length field.
+    ///
+    /// @details
+    /// The test succeeds if all frames are decoded with the expected contents.
+    TEST(IoTest, FrameDecoderLengthPrefix)
+    {
+        // Frame: [type (1)] [length (2, little endian)] [payload] [crc (1)]
+        Packer packer{};
+
+        for (const auto& payload : std::vector<std::string>{"a", "", "hello", std::string(300, 'x')})
+        {
+            packer.insert_byte(0xAA);
+            packer.insert_integral<std::uint16_t, 2, Packer::Order::little>(static_cast<std::uint16_t>(payload.size()));
+            packer.insert_string(payload);
+            packer.insert_byte(0x55);
+        }
+
+        for (std::size_t chunk : {1, 3, 100, 1000})
+        {
+            FrameDecoder decoder{FrameDecoder::length_prefix<std::uint16_t, 2, FrameDecoder::Order::little>(1, 1), 16};
+            std::vector<std::size_t> sizes{};
+
+            for (std::size_t offset = 0; offset < packer.size(); offset += chunk)
+            {
+                std::size_t count{std::min(chunk, packer.size() - offset)};
+
+                decoder.push(FrameDecoder::View{packer.data()}.subspan(offset, count));
+
+                while (auto frame{decoder.next()})
+                {
+                    ASSERT_EQ(frame->extract_integral<std::uint8_t>(0), 0xAA);
+                    ASSERT_EQ(frame->extract_integral<std::uint8_t>(frame->size() - 1), 0x55);
+                    sizes.push_back(frame->size() - 4);
+                }
+            }
+
+            ASSERT_THAT(sizes, ::testing::ElementsAre(1, 0, 5, 300));
+            ASSERT_TRUE(decoder.pending().empty());
+        }
+    }
+
+    /// @brief Test decoding frames with a custom framing function.
+    ///
+    /// @details
+    /// The test succeeds if the frame sizes are determined by the message type.
+    TEST(IoTest, FrameDecoderCustom)
+    {
+        // Type 0x01 has 2 bytes of payload, type 0x02 has 4 bytes
+        FrameDecoder decoder{[](const Parser& pending) -> std::optional<std::size_t>
+                             {
+                                 switch (pending.extract_integral<std::uint8_t>(0))
+                                 {
+                                     case 0x01:
+                                         return 3;
+                                     case 0x02:
+                                         return 5;
+                                     default:
+                                         throw std::invalid_argument("unknown type");
+                                 }
+                             }};
+
+        std::vector<std::uint8_t> data{0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0xAB, 0xCD, 0x02, 0x01};
+
+        decoder.push(data);
+
+        auto first{decoder.next()};
+        auto second{decoder.next()};
+
+        ASSERT_TRUE(first);
+        ASSERT_TRUE(second);
+        ASSERT_EQ(first->extract_integral<std::uint32_t>(1), 1);
+        ASSERT_EQ(second->extract_integral<std::uint16_t>(1), 0xABCD);
+        ASSERT_FALSE(decoder.next());
+
+        // Frames point to the internal buffer (no copies)
+        ASSERT_EQ(first->view().data() + 5, second->view().data());
+
+        // Discard the incomplete frame
+        decoder.clear();
+        decoder.push(std::vector<std::uint8_t>{0xFF});
+
+        ASSERT_THROW(decoder.next(), std::invalid_argument);
+    }
+
+    /// @brief Test reading directly into the decoder.
+    ///
+    /// @details
+    /// The test succeeds if the buffer grows to fit large frames and committed bytes are decoded.
+    TEST(IoTest, FrameDecoderPrepareCommit)
+    {
+        FrameDecoder decoder{FrameDecoder::length_prefix<std::uint32_t>(), 16};
+
+        Packer packer{};
+        packer.insert_integral(std::uint32_t{1000});
+        packer.insert_bytes(std::vector<std::uint8_t>(1000, 0x42));
+
+        auto region{decoder.prepare(packer.size())};
+
+        ASSERT_GE(region.size(), packer.size());
+        ASSERT_GE(decoder.capacity(), packer.size());
+
+        std::memcpy(region.data(), packer.data().data(), packer.size());
+
+        ASSERT_THROW(decoder.commit(region.size() + 1), std::out_of_range);
+
+        decoder.commit(packer.size() - 1);
+
+        ASSERT_FALSE(decoder.next());
+
+        decoder.prepare(1)[0] = packer.data().back();
+        decoder.commit(1);
+
+        auto frame{decoder.next()};
+
+        ASSERT_TRUE(frame);
+        ASSERT_EQ(frame->size(), 1004);
+        ASSERT_FALSE(decoder.next());
+    }
+
+    /// @brief Test the maximum frame size.
+    ///
+    /// @details
+    /// The test succeeds if frames exceeding the maximum size are rejected.
+    TEST(IoTest, FrameDecoderMaxFrameSize)
+    {
+        FrameDecoder length_decoder{FrameDecoder::length_prefix<std::uint8_t>(), 16, 32};
+
+        length_decoder.push(std::vector<std::uint8_t>{0x40});
+
+        ASSERT_THROW(length_decoder.next(), std::length_error);
+
+        FrameDecoder delimiter_decoder{FrameDecoder::delimiter(0x00), 16, 32};
+
+        delimiter_decoder.push(std::vector<std::uint8_t>(31, 0x01));
+
+        ASSERT_FALSE(delimiter_decoder.next());
+
+        delimiter_decoder.push(std::vector<std::uint8_t>{0x01});
+
+        ASSERT_THROW(delimiter_decoder.next(), std::length_error);
+
+        delimiter_decoder.clear();
+
+        ASSERT_TRUE(delimiter_decoder.pending().empty());
+    }
+}  // namespace kouta::tests::io
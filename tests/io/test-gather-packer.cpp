@@ -0,0 +1,176 @@
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/gather-packer.hpp>
+#include <kouta/io/parser.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+    namespace asio = kouta::base::asio;
+
+    namespace
+    {
+        /// @brief Concatenate the buffers of a packer.
+        std::vector<std::uint8_t> flatten(GatherPacker& packer)
+        {
+            std::vector<std::uint8_t> result{};
+
+            for (const auto& buf : packer.buffers())
+            {
+                const auto* first{static_cast<const std::uint8_t*>(buf.data())};
+
+                result.insert(result.end(), first, first + buf.size());
+            }
+
+            return result;
+        }
+    }  // namespace
+
+    /// @brief Test that small sequences are copied and large ones are referenced.
+    ///
+    /// @details
+    /// The test succeeds if the resulting buffers reference the large payload and contain the expected bytes.
+    TEST(IoTest, GatherPackerBuffers)
+    {
+        std::vector<std::uint8_t> small{0x01, 0x02, 0x03};
+        std::vector<std::uint8_t> large(1024);
+        std::iota(large.begin(), large.end(), 0);
+
+        GatherPacker packer{16};
+
+        packer.insert_integral(std::uint16_t{0xCAFE});
+        packer.insert_bytes(std::span<const std::uint8_t>{small});
+        packer.insert_bytes(std::span<const std::uint8_t>{large});
+        packer.insert_integral(std::uint8_t{0xFF});
+        packer.insert_reference(std::span<const std::uint8_t>{small});
+
+        // Inline data only contains the copied fields
+        ASSERT_EQ(packer.data().size(), 2 + 3 + 1);
+        ASSERT_EQ(packer.size(), 2 + 3 + 1024 + 1 + 3);
+
+        const auto& buffers{packer.buffers()};
+
+        ASSERT_EQ(buffers.size(), 4);
+        ASSERT_EQ(buffers[0].size(), 5);
+        ASSERT_EQ(buffers[1].data(), large.data());
+        ASSERT_EQ(buffers[1].size(), large.size());
+        ASSERT_EQ(buffers[2].size(), 1);
+        ASSERT_EQ(buffers[3].data(), small.data());
+        ASSERT_EQ(asio::buffer_size(buffers), packer.size());
+
+        std::vector<std::uint8_t> expected{0xCA, 0xFE, 0x01, 0x02, 0x03};
+        expected.insert(expected.end(), large.begin(), large.end());
+        expected.push_back(0xFF);
+        expected.insert(expected.end(), small.begin(), small.end());
+
+        ASSERT_EQ(flatten(packer), expected);
+
+        packer.clear();
+
+        ASSERT_EQ(packer.size(), 0);
+        ASSERT_TRUE(packer.buffers().empty());
+    }
+
+    /// @brief Test writing a header and a large payload with a single gather operation.
+    ///
+    /// @details
+    /// The test succeeds if the peer receives the whole message.
+    TEST(IoTest, GatherPackerWrite)
+    {
+        asio::io_context context{};
+        asio::local::stream_protocol::socket writer{context};
+        asio::local::stream_protocol::socket reader{context};
+
+        asio::local::connect_pair(writer, reader);
+
+        std::vector<std::uint8_t> payload(1024 * 1024);
+        std::iota(payload.begin(), payload.end(), 0);
+
+        GatherPacker packer{};
+
+        packer.insert_integral(std::uint64_t{payload.size()});
+        packer.insert_integral(std::uint64_t{0x0123456789ABCDEF});
+        packer.insert_bytes(std::span<const std::uint8_t>{payload});
+
+        ASSERT_EQ(packer.data().size(), 16);
+        ASSERT_EQ(packer.buffers().size(), 2);
+
+        std::vector<std::uint8_t> received(packer.size());
+        std::thread peer{[&reader, &received]()
+                         {
+                             asio::read(reader, asio::buffer(received));
+                         }};
+
+        ASSERT_EQ(asio::write(writer, packer.buffers()), packer.size());
+
+        peer.join();
+
+        ASSERT_EQ(received, flatten(packer));
+    }
+
+    /// @brief Test patching the length of a message that references large payloads.
+    ///
+    /// @details
+    /// The test succeeds if the length takes into account the referenced payload.
+    TEST(IoTest, GatherPackerPatchLength)
+    {
+        std::vector<std::uint8_t> payload(1000);
+
+        GatherPacker packer{};
+
+        packer.insert_reference(std::span<const std::uint8_t>{payload});
+        auto length{packer.reserve<std::uint32_t>()};
+        packer.insert_bytes(std::span<const std::uint8_t>{payload});
+        packer.insert_integral(std::uint16_t{0});
+
+        packer.patch_length(length);
+
+        ASSERT_EQ(Parser{packer.data()}.extract_integral<std::uint32_t>(0), 1000 + 2);
+
+        packer.patch_length(length, 0);
+
+        ASSERT_EQ(Parser{packer.data()}.extract_integral<std::uint32_t>(0), 1000 + 4 + 1000 + 2);
+    }
+
+    /// @brief Test computing checksums over a message that references a large payload.
+    ///
+    /// @details
+    /// The test succeeds if the checksums (as well as the size and length), computed through a reference to the base
+    /// @ref Packer, match those of the same message packed inline.
+    TEST(IoTest, GatherPackerChecksum)
+    {
+        std::vector<std::uint8_t> payload(1000);
+        std::iota(payload.begin(), payload.end(), 0);
+
+        auto pack = [&payload](auto& packer)
+        {
+            auto length{packer.template reserve<std::uint16_t>()};
+            auto crc{packer.template reserve<std::uint16_t>()};
+
+            packer.insert_integral(std::uint8_t{0x42});
+            packer.insert_bytes(std::span<const std::uint8_t>{payload});
+            packer.insert_integral(std::uint8_t{0x43});
+
+            Packer& base{packer};
+
+            base.patch_length(length);
+            base.patch_crc(crc, checksum::Crc16{});
+            base.append_checksum<checksum::Crc32c>(0);
+
+            return base.size();
+        };
+
+        Packer expected{};
+        GatherPacker packer{};
+
+        ASSERT_EQ(pack(packer), pack(expected));
+        ASSERT_EQ(packer.buffers().size(), 3);
+        ASSERT_EQ(flatten(packer), expected.data());
+    }
+}  // namespace kouta::tests::io
@@ -0,0 +1,203 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/mapped-file.hpp>
+#include <kouta/io/packer.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+
+    namespace
+    {
+        /// @brief Obtain a unique path for a temporary file.
+        std::filesystem::path temp_path(const std::string& name)
+        {
+            return std::filesystem::temp_directory_path() / ("kouta-" + name + "-" + std::to_string(::getpid()));
+        }
+    }  // namespace
+
+    /// @brief Test mapping an existing file.
+    ///
+    /// @details
+    /// The test succeeds if the contents of the file can be parsed from the mapping.
+    TEST(IoTest, MappedFileRead)
+    {
+        auto path{temp_path("read")};
+
+        {
+            std::ofstream out{path, std::ios::binary};
+            const std::uint8_t bytes[]{0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+
+            out.write(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+        }
+
+        {
+            MappedFile file{path};
+
+            ASSERT_EQ(file.size(), 6);
+            ASSERT_FALSE(file.writable());
+            ASSERT_THROW(file.data(), std::logic_error);
+            ASSERT_THROW(file.resize(10), std::logic_error);
+
+            file.advise(MappedFile::Advice::Sequential);
+
+            ASSERT_EQ(file.parser().extract_integral<std::uint32_t>(0), 0x01020304);
+            ASSERT_EQ(file.parser(4, 2).extract_integral<std::uint16_t>(0), 0x0506);
+            ASSERT_THROW(file.parser(4, 3), std::out_of_range);
+
+            // Moving transfers the mapping
+            MappedFile moved{std::move(file)};
+
+            ASSERT_EQ(moved.size(), 6);
+            ASSERT_EQ(moved.view()[5], 0x06);
+        }
+
+        std::filesystem::remove(path);
+
+        ASSERT_THROW(MappedFile{path}, std::system_error);
+    }
+
+    /// @brief Test writing and resizing a mapped file.
+    ///
+    /// @details
+    /// The test succeeds if the file can be grown and shrunk, and the changes are visible when mapping it again.
+    TEST(IoTest, MappedFileResize)
+    {
+        auto path{temp_path("resize")};
+
+        {
+            MappedFile file{path, MappedFile::Mode::Create};
+
+            ASSERT_EQ(file.size(), 0);
+            ASSERT_TRUE(file.view().empty());
+
+            file.resize(8192);
+            file.data()[0] = 0xAA;
+            file.data()[8191] = 0xBB;
+
+            file.resize(100000);
+            ASSERT_EQ(file.view()[0], 0xAA);
+            ASSERT_EQ(file.view()[8191], 0xBB);
+
+            file.resize(4);
+            file.sync();
+        }
+
+        ASSERT_EQ(std::filesystem::file_size(path), 4);
+
+        {
+            MappedFile file{path, MappedFile::Mode::ReadWrite};
+
+            ASSERT_EQ(file.view()[0], 0xAA);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Test the mapped packer.
+    ///
+    /// @details
+    /// The test succeeds if the file grows as needed and contains the same bytes a @ref Packer would generate.
+    TEST(IoTest, MappedPacker)
+    {
+        auto path{temp_path("packer")};
+        Packer expected{};
+
+        {
+            MappedPacker packer{path, 16};
+
+            for (std::uint32_t i = 0; i < 1000; i++)
+            {
+                packer.insert_integral<std::uint32_t, 3>(i);
+                expected.insert_integral<std::uint32_t, 3>(i);
+
+                packer.insert_integral<std::int16_t, 2, Packer::Order::little>(-static_cast<std::int16_t>(i));
+                expected.insert_integral<std::int16_t, 2, Packer::Order::little>(-static_cast<std::int16_t>(i));
+
+                packer.insert_varint(i * 1000);
+                expected.insert_varint(i * 1000);
+
+                packer.insert_floating_point<double>(i * 0.5);
+                expected.insert_floating_point<double>(i * 0.5);
+
+                packer.insert_byte(0xFF);
+                expected.insert_byte(0xFF);
+            }
+
+            packer.insert_string("end");
+            expected.insert_string("end");
+
+            Packer record{};
+
+            record.insert_integral<std::uint64_t>(0x0102030405060708);
+            packer.insert_bytes(record.data());
+            expected.insert_bytes(record.data());
+
+            ASSERT_EQ(packer.size(), expected.size());
+            ASSERT_GE(packer.capacity(), packer.size());
+            ASSERT_TRUE(std::ranges::equal(packer.view(), expected.data()));
+
+            packer.finish();
+
+            ASSERT_EQ(packer.capacity(), packer.size());
+            ASSERT_THROW(packer.insert_byte(0), std::logic_error);
+        }
+
+        {
+            MappedFile file{path};
+
+            ASSERT_EQ(file.size(), expected.size());
+            ASSERT_TRUE(std::ranges::equal(file.view(), expected.data()));
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    /// @brief Test moving mapped packers.
+    ///
+    /// @details
+    /// The test succeeds if the packer that is assigned over is finished (truncating its file), and the moved-from
+    /// packers are left finished.
+    TEST(IoTest, MappedPackerMove)
+    {
+        auto first_path{temp_path("move-first")};
+        auto second_path{temp_path("move-second")};
+
+        {
+            MappedPacker first{first_path, 16};
+            MappedPacker second{second_path, 16};
+
+            first.insert_string("first");
+            second.insert_string("second");
+
+            MappedPacker moved{std::move(first)};
+
+            ASSERT_EQ(moved.size(), 5);
+            ASSERT_EQ(first.size(), 0);
+            ASSERT_THROW(first.insert_byte(0), std::logic_error);
+
+            moved = std::move(second);
+
+            ASSERT_EQ(moved.size(), 6);
+            ASSERT_THROW(second.insert_byte(0), std::logic_error);
+            ASSERT_EQ(std::filesystem::file_size(first_path), 5);
+
+            moved.insert_byte('!');
+        }
+
+        ASSERT_EQ(std::filesystem::file_size(first_path), 5);
+        ASSERT_EQ(std::filesystem::file_size(second_path), 7);
+
+        std::filesystem::remove(first_path);
+        std::filesystem::remove(second_path);
+    }
+}  // namespace kouta::tests::io
@@ -1,4 +1,5 @@
 #include <cstdint>
+#include <numeric>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -195,4 +196,95 @@ namespace kouta::tests::io
 
         ASSERT_TRUE(std::equal(view.begin(), view.end(), packer.data().begin() + 1));
     }
+
+    /// @brief Test reserving a region and patching it later on.
+    ///
+    /// @details The test succeeds if the values are stored in the reserved regions.
+    TEST(IoTest, PackerReservePatch)
+    {
+        Packer packer{};
+
+        packer.insert_byte(0xAA);
+        auto length{packer.reserve<std::uint16_t>()};
+        auto crc{packer.reserve<std::uint8_t>()};
+        auto flags{packer.reserve<std::uint32_t, 3, Packer::Order::little>()};
+        packer.insert_bytes({0x01, 0x02, 0x03, 0x04});
+
+        ASSERT_EQ(length.offset(), 1);
+        ASSERT_EQ(crc.offset(), 3);
+        ASSERT_EQ(flags.offset(), 4);
+        ASSERT_EQ(packer.size(), 1 + 2 + 1 + 3 + 4);
+
+        packer.patch(flags, 0x0A0B0C);
+
+        // Length of everything following the length field
+        packer.patch_length(length);
+
+        // Sum of the payload
+        packer.patch_crc(
+            crc,
+            [](std::span<const std::uint8_t> view)
+            {
+                return std::accumulate(view.begin(), view.end(), std::uint8_t{0});
+            },
+            7);
+
+        std::vector<std::uint8_t> buf{0xAA, 0x00, 0x08, 0x0A, 0x0C, 0x0B, 0x0A, 0x01, 0x02, 0x03, 0x04};
+
+        ASSERT_EQ(packer.data(), buf);
+
+        // Length from a specific offset
+        packer.patch_length(length, 0);
+
+        ASSERT_EQ(packer.data()[2], 11);
+    }
+
+    /// @brief Test the error conditions when patching reserved regions.
+    ///
+    /// @details The test succeeds if an exception is thrown for each invalid operation.
+    TEST(IoTest, PackerReservePatchErrors)
+    {
+        Packer packer{};
+
+        auto length{packer.reserve<std::uint8_t>()};
+        auto crc{packer.reserve<std::uint16_t>()};
+        std::vector<std::uint8_t> payload(300);
+        packer.insert_bytes(payload.cbegin(), payload.cend());
+
+        auto checksum = [](std::span<const std::uint8_t> view)
+        {
+            return view.size();
+        };
+
+        // 302 does not fit in a single byte
+        ASSERT_THROW(packer.patch_length(length), std::overflow_error);
+
+        // Overlaps the placeholder
+        ASSERT_THROW(packer.patch_crc(crc, checksum, 0), std::invalid_argument);
+
+        // Out of bounds
+        ASSERT_THROW(packer.patch_crc(crc, checksum, 3, 1000), std::out_of_range);
+        ASSERT_THROW(packer.patch_length(length, 1000), std::out_of_range);
+
+        packer.data().clear();
+
+        ASSERT_THROW(packer.patch(crc, 0), std::out_of_range);
+
+        // Signed placeholders only accept values that do not wrap negative
+        auto small{packer.reserve<std::int8_t>()};
+        auto wide{packer.reserve<std::int32_t, 2>()};
+        packer.insert_bytes(payload.cbegin(), payload.cbegin() + 127);
+
+        // 127 and 129 bytes
+        ASSERT_NO_THROW(packer.patch_length(small, 3));
+        ASSERT_THROW(packer.patch_length(small), std::overflow_error);
+        ASSERT_NO_THROW(packer.patch_length(wide));
+        ASSERT_EQ(packer.data()[0], 127);
+        ASSERT_EQ(packer.data()[1], 0x00);
+        ASSERT_EQ(packer.data()[2], 127);
+
+        packer.data().resize(0x8000 + 3);
+
+        ASSERT_THROW(packer.patch_length(wide), std::overflow_error);
+    }
 }  // namespace kouta::tests::io
@@ -158,4 +158,51 @@ namespace kouta::tests::io
 
         ASSERT_THROW(parser.extract_integral<std::uint64_t>(2), std::out_of_range);
     }
+
+    /// @brief Test the extraction of views (strings and bytes) from the parser.
+    ///
+    /// @details
+    /// The test succeeds if the extracted views point to the underlying data and have the expected contents.
+    TEST(IoTest, ParserViews)
+    {
+        std::vector<std::uint8_t> buf{
+            // clang-format off
+            // string: "Hello"
+            0x48, 0x65, 0x6C, 0x6C, 0x6F,
+            // null-terminated string: "World"
+            0x57, 0x6F, 0x72, 0x6C, 0x64, 0x00,
+            // bytes
+            0x82, 0x18, 0x48,
+            // non-terminated string: "!!"
+            0x21, 0x21
+            // clang-format on
+        };
+
+        Parser parser{buf};
+
+        auto str_view{parser.extract_string_view(0, 5)};
+        ASSERT_EQ(str_view, "Hello");
+        ASSERT_EQ(reinterpret_cast<const std::uint8_t*>(str_view.data()), buf.data());
+
+        auto cstr_view{parser.extract_cstring_view(5)};
+        ASSERT_EQ(cstr_view, "World");
+        ASSERT_EQ(reinterpret_cast<const std::uint8_t*>(cstr_view.data()), buf.data() + 5);
+
+        ASSERT_EQ(parser.extract_cstring_view(10), "");
+        ASSERT_EQ(parser.extract_cstring_view(14), "!!");
+        ASSERT_EQ(parser.extract_cstring_view(buf.size()), "");
+
+        auto bytes{parser.extract_bytes(11, 3)};
+        ASSERT_EQ(bytes.size(), 3);
+        ASSERT_EQ(bytes.data(), buf.data() + 11);
+        ASSERT_TRUE(std::equal(bytes.begin(), bytes.end(), buf.cbegin() + 11));
+
+        // Nested parser over the extracted bytes
+        Parser nested{bytes};
+        ASSERT_EQ(nested.extract_integral<std::uint16_t>(1), std::uint16_t{0x1848});
+
+        ASSERT_THROW(parser.extract_string_view(14, 3), std::out_of_range);
+        ASSERT_THROW(parser.extract_bytes(0, buf.size() + 1), std::out_of_range);
+        ASSERT_THROW(parser.extract_cstring_view(buf.size() + 1), std::out_of_range);
+    }
 }  // namespace kouta::tests::io
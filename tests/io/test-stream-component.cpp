@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/base/callback.hpp>
+#include <kouta/base/root.hpp>
+#include <kouta/io/gather-packer.hpp>
+#include <kouta/io/stream-component.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+    namespace asio = kouta::base::asio;
+
+    namespace
+    {
+        using LocalStream = StreamComponent<asio::local::stream_protocol::socket>;
+        using TcpStream = StreamComponent<asio::ip::tcp::socket>;
+
+        /// @brief Root that owns two connected stream components and records the received frames.
+        template<class TStream>
+        class StreamRoot : public base::Root
+        {
+        public:
+            explicit StreamRoot(const FrameDecoder::Framer& framer)
+                : base::Root{}
+                , first{this,
+                        framer,
+                        base::callback::DirectCallback{this, &StreamRoot::handle_first_frame},
+                        base::callback::DirectCallback{this, &StreamRoot::handle_first_error}}
+                , second{this,
+                         framer,
+                         base::callback::DirectCallback{this, &StreamRoot::handle_second_frame},
+                         base::callback::DirectCallback{this, &StreamRoot::handle_second_error}}
+                , first_frames{}
+                , second_frames{}
+                , first_errors{}
+                , second_errors{}
+                , expected_frames{0}
+            {
+            }
+
+            TStream first;
+            TStream second;
+            std::vector<std::vector<std::uint8_t>> first_frames;
+            std::vector<std::vector<std::uint8_t>> second_frames;
+            std::vector<asio::error_code> first_errors;
+            std::vector<asio::error_code> second_errors;
+            std::size_t expected_frames;
+
+        private:
+            void handle_first_frame(const Parser& frame)
+            {
+                first_frames.emplace_back(frame.view().begin(), frame.view().end());
+                check_done();
+            }
+
+            void handle_second_frame(const Parser& frame)
+            {
+                second_frames.emplace_back(frame.view().begin(), frame.view().end());
+
+                // Echo the frame back
+                Packer packer{};
+                packer.insert_bytes(frame.view());
+                second.send(std::move(packer));
+
+                check_done();
+            }
+
+            void handle_first_error(const asio::error_code& ec)
+            {
+                first_errors.push_back(ec);
+                stop();
+            }
+
+            void handle_second_error(const asio::error_code& ec)
+            {
+                second_errors.push_back(ec);
+                stop();
+            }
+
+            void check_done()
+            {
+                if (first_frames.size() == expected_frames && second_frames.size() == expected_frames)
+                {
+                    stop();
+                }
+            }
+        };
+
+        /// @brief Create a frame with a 2-byte length prefix.
+        Packer make_frame(const std::string& payload)
+        {
+            Packer packer{};
+
+            packer.insert_integral(static_cast<std::uint16_t>(payload.size()));
+            packer.insert_string(payload);
+
+            return packer;
+        }
+
+        /// @brief Packer type unknown to the stream component.
+        class DerivedPacker : public Packer
+        {
+        };
+
+        /// @brief Check whether a packer can be sent through a stream component.
+        template<class TPacker>
+        concept Sendable = requires(LocalStream& stream, TPacker packer) { stream.send(std::move(packer)); };
+
+        static_assert(Sendable<Packer>);
+        static_assert(Sendable<GatherPacker>);
+        static_assert(!Sendable<DerivedPacker>, "Other packers would be sliced");
+    }  // namespace
+
+    /// @brief Test exchanging frames over a socket pair.
+    ///
+    /// @details
+    /// The test succeeds if all frames sent in a burst are received and echoed back in order.
+    TEST(IoTest, StreamComponentSocketPair)
+    {
+        StreamRoot<LocalStream> root{FrameDecoder::length_prefix<std::uint16_t>()};
+
+        asio::local::connect_pair(root.first.stream(), root.second.stream());
+
+        root.first.start();
+        root.second.start();
+
+        std::vector<std::string> payloads{"first", "", "third", std::string(10000, 'x')};
+        root.expected_frames = payloads.size();
+
+        for (const auto& payload : payloads)
+        {
+            root.first.send(make_frame(payload));
+        }
+
+        // The frames sent while the first write is in flight are batched
+        ASSERT_EQ(root.first.pending(), payloads.size());
+
+        alarm(2);
+        root.run();
+        alarm(0);
+
+        ASSERT_EQ(root.first.pending(), 0);
+        ASSERT_EQ(root.second_frames.size(), payloads.size());
+        ASSERT_EQ(root.first_frames, root.second_frames);
+
+        for (std::size_t i = 0; i < payloads.size(); i++)
+        {
+            ASSERT_EQ(root.second_frames[i], make_frame(payloads[i]).data());
+        }
+    }
+
+    /// @brief Test exchanging frames over a loopback TCP connection.
+    ///
+    /// @details
+    /// The test succeeds if all frames are echoed back and closing the connection is reported to the peer.
+    TEST(IoTest, StreamComponentTcp)
+    {
+        StreamRoot<TcpStream> root{FrameDecoder::delimiter('\n')};
+
+        asio::ip::tcp::acceptor acceptor{root.context(), {asio::ip::address_v4::loopback(), 0}};
+
+        root.first.stream().connect(acceptor.local_endpoint());
+        acceptor.accept(root.second.stream());
+
+        root.first.start();
+        root.second.start();
+
+        root.expected_frames = 100;
+
+        for (std::size_t i = 0; i < root.expected_frames; i++)
+        {
+            Packer packer{};
+            packer.insert_string("frame " + std::to_string(i) + "\n");
+            root.first.send(std::move(packer));
+        }
+
+        alarm(2);
+        root.run();
+        alarm(0);
+
+        ASSERT_EQ(root.first_frames.size(), root.expected_frames);
+        ASSERT_EQ(root.first_frames, root.second_frames);
+        ASSERT_EQ(std::string(root.first_frames[42].begin(), root.first_frames[42].end()), "frame 42\n");
+
+        // Closing the connection is reported as an error to the peer
+        root.first.close();
+
+        alarm(2);
+        root.context().restart();
+        root.run();
+        alarm(0);
+
+        ASSERT_TRUE(root.first_errors.empty());
+        ASSERT_EQ(root.second_errors.size(), 1);
+        ASSERT_EQ(root.second_errors[0], asio::error::eof);
+    }
+
+    /// @brief Test closing a stream with operations in flight.
+    ///
+    /// @details
+    /// The test succeeds if the frames of the write operation in flight are kept until its cancellation completes, and
+    /// the cancellations are not reported as errors.
+    TEST(IoTest, StreamComponentCloseInFlight)
+    {
+        StreamRoot<LocalStream> root{FrameDecoder::length_prefix<std::uint16_t>()};
+
+        asio::local::connect_pair(root.first.stream(), root.second.stream());
+
+        root.first.start();
+        root.first.send(make_frame("in flight"));
+        root.first.send(make_frame("queued"));
+
+        ASSERT_EQ(root.first.pending(), 2);
+
+        root.first.close();
+
+        // The queued frame is discarded right away
+        ASSERT_EQ(root.first.pending(), 1);
+
+        alarm(2);
+        root.context().poll();
+        alarm(0);
+
+        ASSERT_EQ(root.first.pending(), 0);
+        ASSERT_TRUE(root.first_errors.empty());
+        ASSERT_TRUE(root.first_frames.empty());
+    }
+
+    /// @brief Test sending frames that reference external memory.
+    ///
+    /// @details
+    /// The test succeeds if the referenced sequences are sent along with the inline data.
+    TEST(IoTest, StreamComponentGather)
+    {
+        StreamRoot<LocalStream> root{FrameDecoder::length_prefix<std::uint16_t>()};
+
+        asio::local::connect_pair(root.first.stream(), root.second.stream());
+
+        root.first.start();
+        root.second.start();
+
+        std::vector<std::uint8_t> payload(1000, 0xab);
+        GatherPacker packer{};
+
+        packer.insert_integral(static_cast<std::uint16_t>(payload.size() + 1));
+        packer.insert_bytes(GatherPacker::View{payload});
+        packer.insert_integral(std::uint8_t{0xcd});
+
+        ASSERT_EQ(packer.data().size(), 3);
+
+        root.expected_frames = 1;
+        root.first.send(std::move(packer));
+
+        alarm(2);
+        root.run();
+        alarm(0);
+
+        ASSERT_EQ(root.second_frames.size(), 1);
+        ASSERT_EQ(root.second_frames[0].size(), payload.size() + 3);
+        ASSERT_TRUE(std::equal(payload.begin(), payload.end(), root.second_frames[0].begin() + 2));
+        ASSERT_EQ(root.second_frames[0].back(), 0xcd);
+        ASSERT_EQ(root.first_frames, root.second_frames);
+    }
+
+    /// @brief Test destroying a stream with operations in flight.
+    ///
+    /// @details
+    /// The test succeeds if the completions of the cancelled operations do not access the destroyed component (which
+    /// is detected when running with AddressSanitizer).
+    TEST(IoTest, StreamComponentDestroyInFlight)
+    {
+        base::Root root{};
+        asio::local::stream_protocol::socket peer{root.context()};
+        auto* stream{new LocalStream{&root, FrameDecoder::length_prefix<std::uint16_t>(), {}, {}}};
+
+        asio::local::connect_pair(stream->stream(), peer);
+
+        stream->start();
+        stream->send(make_frame("in flight"));
+
+        delete stream;
+
+        alarm(2);
+        root.context().poll();
+        alarm(0);
+
+        ASSERT_TRUE(root.context().stopped());
+    }
+
+    /// @brief Test receiving a frame that exceeds the maximum size.
+    ///
+    /// @details
+    /// The test succeeds if the error is reported and the stream is closed.
+    TEST(IoTest, StreamComponentInvalidFrame)
+    {
+        StreamRoot<LocalStream> root{FrameDecoder::length_prefix<std::uint8_t>(0, -2)};
+
+        asio::local::connect_pair(root.first.stream(), root.second.stream());
+
+        root.second.start();
+
+        // Length smaller than the adjustment
+        Packer packer{};
+        packer.insert_integral(std::uint8_t{1});
+        root.first.send(std::move(packer));
+
+        alarm(2);
+        root.run();
+        alarm(0);
+
+        ASSERT_EQ(root.second_errors.size(), 1);
+        ASSERT_EQ(root.second_errors[0], asio::error::message_size);
+        ASSERT_FALSE(root.second.stream().is_open());
+    }
+}  // namespace kouta::tests::io
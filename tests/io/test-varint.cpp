@@ -0,0 +1,189 @@
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/io/packer.hpp>
+#include <kouta/io/parser.hpp>
+#include <kouta/io/varint.hpp>
+
+namespace kouta::tests::io
+{
+    using namespace kouta::io;
+
+    /// @brief Check whether a type can be extracted as a variable-length integer.
+    template<class TValue>
+    concept Extractable = requires(const Parser& parser) { parser.extract_varint<TValue>(0); };
+
+    /// @brief Check whether a type can be inserted as a variable-length integer.
+    template<class TValue>
+    concept Insertable = requires(Packer& packer, TValue value) { packer.insert_varint(value); };
+
+    /// @brief Test the ZigZag encoding of signed values.
+    ///
+    /// @details
+    /// The test succeeds if values of small magnitude are mapped to small values and decoding reverts the encoding.
+    TEST(IoTest, VarintZigzag)
+    {
+        ASSERT_EQ(varint::zigzag_encode(std::int32_t{0}), std::uint32_t{0});
+        ASSERT_EQ(varint::zigzag_encode(std::int32_t{-1}), std::uint32_t{1});
+        ASSERT_EQ(varint::zigzag_encode(std::int32_t{1}), std::uint32_t{2});
+        ASSERT_EQ(varint::zigzag_encode(std::int32_t{-2}), std::uint32_t{3});
+        ASSERT_EQ(varint::zigzag_encode(std::numeric_limits<std::int32_t>::max()), std::uint32_t{0xFFFFFFFE});
+        ASSERT_EQ(varint::zigzag_encode(std::numeric_limits<std::int32_t>::min()), std::uint32_t{0xFFFFFFFF});
+        ASSERT_EQ(varint::zigzag_encode(std::int8_t{-64}), std::uint8_t{127});
+
+        for (std::int64_t value : {0LL, -1LL, 1LL, -9827LL, 7465LL, -92843749392737493LL})
+        {
+            ASSERT_EQ(varint::zigzag_decode(varint::zigzag_encode(value)), value);
+        }
+
+        ASSERT_EQ(varint::zigzag_decode(varint::zigzag_encode(std::int16_t{-32768})), std::int16_t{-32768});
+    }
+
+    /// @brief Test the encoding of variable-length integers with the packer.
+    ///
+    /// @details
+    /// The test succeeds if the resulting byte sequence matches the expected one.
+    TEST(IoTest, VarintPacker)
+    {
+        std::vector<std::uint8_t> buf{
+            // clang-format off
+            // uint8: 0
+            0x00,
+            // uint16: 127
+            0x7F,
+            // uint16: 128
+            0x80, 0x01,
+            // uint32: 300
+            0xAC, 0x02,
+            // uint32: 16384
+            0x80, 0x80, 0x01,
+            // int32: -1
+            0x01,
+            // int32: -65
+            0x81, 0x01,
+            // uint64: max
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01
+            // clang-format on
+        };
+
+        Packer packer{};
+
+        packer.insert_varint(std::uint8_t{0});
+        packer.insert_varint(std::uint16_t{127});
+        packer.insert_varint(std::uint16_t{128});
+        packer.insert_varint(std::uint32_t{300});
+        packer.insert_varint(std::uint32_t{16384});
+        packer.insert_varint(std::int32_t{-1});
+        packer.insert_varint(std::int32_t{-65});
+        packer.insert_varint(std::numeric_limits<std::uint64_t>::max());
+
+        ASSERT_EQ(packer.size(), buf.size());
+        ASSERT_TRUE(std::equal(packer.data().cbegin(), packer.data().cend(), buf.cbegin()));
+
+        ASSERT_EQ(varint::encoded_size(std::uint32_t{300}), 2);
+        ASSERT_EQ(varint::encoded_size(std::int32_t{-65}), 2);
+        ASSERT_EQ(varint::encoded_size(std::numeric_limits<std::uint64_t>::max()), varint::max_size<std::uint64_t>);
+    }
+
+    /// @brief Test the decoding of variable-length integers with the parser.
+    ///
+    /// @details
+    /// The test succeeds if all values can be extracted and the number of bytes read is correct.
+    TEST(IoTest, VarintParser)
+    {
+        Packer packer{};
+
+        std::vector<std::uint64_t> unsigned_values{0, 1, 127, 128, 300, 16383, 16384, 2097151, 99999999999999};
+        std::vector<std::int64_t> signed_values{0, -1, 1, -64, 64, -8192, 8191, -92843749392737493};
+
+        for (auto v : unsigned_values)
+        {
+            packer.insert_varint(v);
+        }
+
+        for (auto v : signed_values)
+        {
+            packer.insert_varint(v);
+        }
+
+        packer.insert_varint(std::numeric_limits<std::uint64_t>::max());
+        packer.insert_varint(std::numeric_limits<std::int64_t>::min());
+
+        Parser parser{packer.data()};
+        std::size_t offset{0};
+
+        for (auto v : unsigned_values)
+        {
+            std::size_t count{};
+
+            ASSERT_EQ(parser.extract_varint<std::uint64_t>(offset, count), v);
+            ASSERT_EQ(count, varint::encoded_size(v));
+            offset += count;
+        }
+
+        for (auto v : signed_values)
+        {
+            std::size_t count{};
+
+            ASSERT_EQ(parser.extract_varint<std::int64_t>(offset, count), v);
+            ASSERT_EQ(count, varint::encoded_size(v));
+            offset += count;
+        }
+
+        std::size_t count{};
+
+        ASSERT_EQ(parser.extract_varint<std::uint64_t>(offset, count), std::numeric_limits<std::uint64_t>::max());
+        offset += count;
+
+        ASSERT_EQ(parser.extract_varint<std::int64_t>(offset, count), std::numeric_limits<std::int64_t>::min());
+        offset += count;
+
+        ASSERT_EQ(offset, parser.size());
+
+        // Batch extraction
+        std::vector<std::uint64_t> batch(unsigned_values.size());
+
+        ASSERT_EQ(parser.extract_varints(0, std::span{batch}), 1 + 1 + 1 + 2 + 2 + 2 + 3 + 3 + 7);
+        ASSERT_EQ(batch, unsigned_values);
+    }
+
+    /// @brief Test the behaviour of the parser when extracting malformed variable-length integers.
+    ///
+    /// @details
+    /// The test succeeds if truncated values and values that overflow the requested type throw an exception.
+    TEST(IoTest, VarintParserErrors)
+    {
+        std::vector<std::uint8_t> buf{
+            // clang-format off
+            // 300 (uint16)
+            0xAC, 0x02,
+            // 16384 (does not fit in uint8/uint16 after shifting)
+            0x80, 0x80, 0x01,
+            // 11 bytes (does not fit in uint64)
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+            // truncated
+            0x80, 0x80
+            // clang-format on
+        };
+
+        Parser parser{buf};
+
+        ASSERT_EQ(parser.extract_varint<std::uint16_t>(0), std::uint16_t{300});
+        ASSERT_THROW(parser.extract_varint<std::uint8_t>(0), std::overflow_error);
+        ASSERT_EQ(parser.extract_varint<std::uint32_t>(2), std::uint32_t{16384});
+        ASSERT_THROW(parser.extract_varint<std::uint8_t>(2), std::overflow_error);
+        ASSERT_THROW(parser.extract_varint<std::uint64_t>(5), std::overflow_error);
+        ASSERT_THROW(parser.extract_varint<std::uint64_t>(16), std::out_of_range);
+        ASSERT_THROW(parser.extract_varint<std::uint64_t>(buf.size()), std::out_of_range);
+
+        // bool has no unsigned counterpart, so it is rejected at compile time
+        static_assert(!varint::Integer<bool>);
+        static_assert(varint::Integer<std::uint8_t> && varint::Integer<std::int64_t>);
+        static_assert(!Extractable<bool> && Extractable<std::int16_t>);
+        static_assert(!Insertable<bool> && Insertable<std::int16_t>);
+    }
+}  // namespace kouta::tests::io
@@ -0,0 +1,94 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/utils/enum-dispatcher.hpp>
+
+namespace kouta::tests::utils
+{
+    using namespace kouta::utils;
+
+    namespace
+    {
+        enum class Message : std::size_t
+        {
+            Ping,
+            Data,
+            Close,
+            Unknown,
+
+            _Total
+        };
+
+        /// @brief Target of the dispatcher, recording the handled messages.
+        class Router
+        {
+        public:
+            std::vector<std::string> handled{};
+
+            void handle_ping(const std::string& payload)
+            {
+                handled.push_back("ping:" + payload);
+            }
+
+            void handle_data(const std::string& payload)
+            {
+                handled.push_back("data:" + payload);
+            }
+
+            void handle_close(const std::string& payload)
+            {
+                handled.push_back("close:" + payload);
+            }
+
+            std::size_t data_size(std::string&& payload, int extra)
+            {
+                std::string moved{std::move(payload)};
+
+                return moved.size() + static_cast<std::size_t>(extra);
+            }
+
+            using Dispatcher = EnumDispatcher<Message,
+                                              Router,
+                                              void(const std::string&),
+                                              Route<Message::Ping, &Router::handle_ping>,
+                                              Route<Message::Data, &Router::handle_data>,
+                                              Route<Message::Close, &Router::handle_close>>;
+
+            using SizeDispatcher = EnumDispatcher<Message,
+                                                  Router,
+                                                  std::size_t(std::string&&, int),
+                                                  Route<Message::Data, &Router::data_size>>;
+        };
+    }  // namespace
+
+    /// @brief Test dispatching values to member functions.
+    ///
+    /// @details
+    /// The test succeeds if each routed value invokes its member function, and unrouted values are reported.
+    TEST(UtilsTest, EnumDispatcher)
+    {
+        Router router{};
+
+        static_assert(Router::Dispatcher::contains(Message::Ping));
+        static_assert(!Router::Dispatcher::contains(Message::Unknown));
+        static_assert(Router::Dispatcher::keys().count() == 3);
+
+        EXPECT_TRUE(Router::Dispatcher::try_dispatch(router, Message::Data, "x"));
+        EXPECT_TRUE(Router::Dispatcher::try_dispatch(router, Message::Ping, "y"));
+        EXPECT_FALSE(Router::Dispatcher::try_dispatch(router, Message::Unknown, "z"));
+        EXPECT_FALSE(Router::Dispatcher::try_dispatch(router, static_cast<Message>(100), "z"));
+        Router::Dispatcher::dispatch(router, Message::Close, "w");
+
+        EXPECT_EQ(router.handled, (std::vector<std::string>{"data:x", "ping:y", "close:w"}));
+        EXPECT_THROW(Router::Dispatcher::dispatch(router, Message::Unknown, "z"), std::out_of_range);
+
+        // Results and arguments are forwarded
+        std::string payload{"abcd"};
+
+        EXPECT_EQ(Router::SizeDispatcher::dispatch(router, Message::Data, std::move(payload), 2), 6);
+        EXPECT_TRUE(payload.empty());
+    }
+}  // namespace kouta::tests::utils
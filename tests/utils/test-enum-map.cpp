@@ -0,0 +1,96 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/utils/enum-map.hpp>
+
+namespace kouta::tests::utils
+{
+    using namespace kouta::utils;
+
+    namespace
+    {
+        enum class MapEnum : std::size_t
+        {
+            A,
+            B,
+            C,
+            D,
+
+            _Total
+        };
+    }  // namespace
+
+    /// @brief Test inserting, accessing and erasing values.
+    TEST(UtilsTest, EnumMapBasic)
+    {
+        EnumMap<MapEnum, std::string> map{{MapEnum::A, "a"}, {MapEnum::C, "c"}};
+
+        EXPECT_EQ(map.size(), 2);
+        EXPECT_TRUE(map.contains(MapEnum::A));
+        EXPECT_FALSE(map.contains(MapEnum::B));
+        EXPECT_FALSE(map.contains(MapEnum::_Total));
+        EXPECT_EQ(map.at(MapEnum::C), "c");
+        EXPECT_THROW(map.at(MapEnum::B), std::out_of_range);
+        EXPECT_EQ(map.find(MapEnum::B), nullptr);
+
+        map[MapEnum::B] += "b";
+        map.insert_or_assign(MapEnum::A, "aa");
+
+        EXPECT_EQ(map.size(), 3);
+        EXPECT_EQ(*map.find(MapEnum::B), "b");
+        EXPECT_EQ(map.at(MapEnum::A), "aa");
+        EXPECT_EQ(map.keys(), (EnumSet<MapEnum>{MapEnum::A, MapEnum::B, MapEnum::C}));
+
+        std::vector<std::string> values{};
+
+        map.for_each(
+            [&values](MapEnum, const std::string& value)
+            {
+                values.push_back(value);
+            });
+
+        EXPECT_EQ(values, (std::vector<std::string>{"aa", "b", "c"}));
+
+        EXPECT_TRUE(map.erase(MapEnum::A));
+        EXPECT_FALSE(map.erase(MapEnum::A));
+        EXPECT_EQ(map.size(), 2);
+
+        map.clear();
+
+        EXPECT_TRUE(map.empty());
+    }
+
+    /// @brief Test that erased values are released.
+    TEST(UtilsTest, EnumMapRelease)
+    {
+        auto item{std::make_shared<int>(42)};
+        EnumMap<MapEnum, std::shared_ptr<int>> map{};
+
+        map[MapEnum::B] = item;
+        map[MapEnum::D] = item;
+
+        EXPECT_EQ(item.use_count(), 3);
+
+        map.erase(MapEnum::B);
+
+        EXPECT_EQ(item.use_count(), 2);
+
+        map.clear();
+
+        EXPECT_EQ(item.use_count(), 1);
+    }
+
+    /// @brief Test using the EnumMap in constant expressions.
+    TEST(UtilsTest, EnumMapConstexpr)
+    {
+        constexpr EnumMap<MapEnum, int> map{{MapEnum::B, 2}, {MapEnum::D, 4}};
+
+        static_assert(map.size() == 2);
+        static_assert(map.at(MapEnum::D) == 4);
+        static_assert(!map.contains(MapEnum::A));
+    }
+}  // namespace kouta::tests::utils
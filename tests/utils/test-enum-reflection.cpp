@@ -0,0 +1,141 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <kouta/utils/enum-map.hpp>
+#include <kouta/utils/enum-reflection.hpp>
+#include <kouta/utils/enum-set.hpp>
+
+namespace kouta::tests::utils
+{
+    using namespace kouta::utils;
+
+    namespace
+    {
+        enum class SparseEnum : std::uint8_t
+        {
+            Hello = 0x01,
+            Data = 0x10,
+            Ack = 0x81,
+            Bye = 0xFF
+        };
+
+        enum class DenseEnum : std::size_t
+        {
+            A,
+            B,
+            C,
+
+            _Total
+        };
+
+        enum class SignedEnum : std::int16_t
+        {
+            Negative = -10,
+            Zero = 0,
+            Large = 1000
+        };
+    }  // namespace
+}  // namespace kouta::tests::utils
+
+template<>
+struct kouta::utils::EnumRange<kouta::tests::utils::SignedEnum>
+{
+    static constexpr long long Min{-16};
+    static constexpr long long Max{1024};
+};
+
+namespace kouta::tests::utils
+{
+    /// @brief Test the reflection of a sparse enumeration.
+    TEST(UtilsTest, EnumReflectionSparse)
+    {
+        using Traits = EnumTraits<SparseEnum>;
+
+        static_assert(!Traits::Dense);
+        static_assert(Traits::Count == 4);
+        static_assert(Traits::index(SparseEnum::Ack) == 2);
+        static_assert(Traits::value(3) == SparseEnum::Bye);
+        static_assert(Traits::name(SparseEnum::Data) == "Data");
+
+        std::vector<std::size_t> indices{};
+
+        for (auto value : {SparseEnum::Hello, SparseEnum::Data, SparseEnum::Ack, SparseEnum::Bye})
+        {
+            indices.push_back(Traits::index(value));
+            EXPECT_EQ(Traits::value(Traits::index(value)), value);
+        }
+
+        EXPECT_EQ(indices, (std::vector<std::size_t>{0, 1, 2, 3}));
+
+        // Values without a label
+        EXPECT_EQ(Traits::index(static_cast<SparseEnum>(0x02)), Traits::Count);
+        EXPECT_EQ(Traits::name(static_cast<SparseEnum>(0x02)), "");
+
+        EXPECT_EQ(Traits::name(SparseEnum::Hello), "Hello");
+        EXPECT_EQ(Traits::from_name("Ack"), SparseEnum::Ack);
+        EXPECT_EQ(Traits::from_name("Nack"), std::nullopt);
+        EXPECT_EQ(Traits::from_name(""), std::nullopt);
+    }
+
+    /// @brief Test that enumerations with a `_Total` label keep using their values as indices.
+    TEST(UtilsTest, EnumReflectionDense)
+    {
+        using Traits = EnumTraits<DenseEnum>;
+
+        static_assert(Traits::Dense);
+        static_assert(Traits::Count == 3);
+        static_assert(Traits::index(DenseEnum::C) == 2);
+        static_assert(Traits::value(1) == DenseEnum::B);
+
+        EXPECT_EQ(Traits::index(DenseEnum::_Total), Traits::Count);
+        EXPECT_EQ(Traits::name(DenseEnum::A), "A");
+        EXPECT_EQ(Traits::name(DenseEnum::_Total), "");
+        EXPECT_EQ(Traits::from_name("C"), DenseEnum::C);
+    }
+
+    /// @brief Test the reflection of an enumeration with a custom range.
+    TEST(UtilsTest, EnumReflectionCustomRange)
+    {
+        using Traits = EnumTraits<SignedEnum>;
+
+        static_assert(Traits::Count == 3);
+
+        EXPECT_EQ(Traits::index(SignedEnum::Negative), 0);
+        EXPECT_EQ(Traits::index(SignedEnum::Zero), 1);
+        EXPECT_EQ(Traits::index(SignedEnum::Large), 2);
+        EXPECT_EQ(Traits::index(static_cast<SignedEnum>(-100)), Traits::Count);
+        EXPECT_EQ(Traits::index(static_cast<SignedEnum>(2000)), Traits::Count);
+        EXPECT_EQ(Traits::name(SignedEnum::Negative), "Negative");
+    }
+
+    /// @brief Test using a sparse enumeration with the enumeration containers.
+    TEST(UtilsTest, EnumReflectionContainers)
+    {
+        EnumSet<SparseEnum> set{SparseEnum::Bye, SparseEnum::Hello};
+
+        static_assert(EnumSet<SparseEnum>::Size == 4);
+        static_assert(EnumSet<SparseEnum>::Words == 1);
+
+        EXPECT_TRUE(set.test(SparseEnum::Hello));
+        EXPECT_FALSE(set.test(SparseEnum::Ack));
+        EXPECT_EQ(set.to_string(), "1001");
+        EXPECT_THROW(set.set(static_cast<SparseEnum>(0x02)), std::out_of_range);
+
+        std::vector<SparseEnum> values{set.begin(), set.end()};
+
+        EXPECT_EQ(values, (std::vector<SparseEnum>{SparseEnum::Hello, SparseEnum::Bye}));
+
+        EnumMap<SparseEnum, std::string> map{{SparseEnum::Ack, "ack"}};
+
+        map[SparseEnum::Data] = "data";
+
+        EXPECT_EQ(map.size(), 2);
+        EXPECT_EQ(map.at(SparseEnum::Ack), "ack");
+        EXPECT_FALSE(map.contains(static_cast<SparseEnum>(0x02)));
+        EXPECT_EQ(map.find(static_cast<SparseEnum>(0x02)), nullptr);
+    }
+}  // namespace kouta::tests::utils
@@ -1,3 +1,11 @@
+#include <bitset>
+#include <concepts>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -17,6 +25,14 @@ namespace kouta::tests::utils
         _Total
     };
 
+    /// Large enumeration, spanning several words.
+    enum class LargeEnum : std::size_t
+    {
+        First,
+
+        _Total = 256
+    };
+
     /// @brief Test the behaviour of the EnumSet when it is default-constructed.
     TEST(UtilsTest, EnumSetEmpty)
     {
@@ -74,4 +90,189 @@ namespace kouta::tests::utils
         EXPECT_EQ(set[TestEnum::C], false);
         EXPECT_EQ(set.test(TestEnum::C), false);
     }
+
+    /// @brief Test using the EnumSet in constant expressions.
+    TEST(UtilsTest, EnumSetConstexpr)
+    {
+        constexpr EnumSet<TestEnum> set{TestEnum::A, TestEnum::C};
+        constexpr auto flipped{~set};
+
+        static_assert(set.count() == 2);
+        static_assert(set.test(TestEnum::C));
+        static_assert(!set[TestEnum::B]);
+        static_assert(flipped == EnumSet<TestEnum>{TestEnum::B, TestEnum::D});
+        static_assert((set | flipped).all());
+        static_assert(EnumSet<TestEnum>{0b1010}.to_ullong() == 0b1010);
+        static_assert(EnumSet<TestEnum>{0xFF}.to_ullong() == 0xF);
+
+        EXPECT_THROW(set.test(4), std::out_of_range);
+        EXPECT_EQ(set.to_string(), "0101");
+    }
+
+    /// @brief Test the set operations.
+    TEST(UtilsTest, EnumSetAlgebra)
+    {
+        EnumSet<TestEnum> a{TestEnum::A, TestEnum::B};
+        EnumSet<TestEnum> b{TestEnum::B, TestEnum::C};
+
+        EXPECT_EQ(a | b, (EnumSet<TestEnum>{TestEnum::A, TestEnum::B, TestEnum::C}));
+        EXPECT_EQ(a & b, EnumSet<TestEnum>{TestEnum::B});
+        EXPECT_EQ(a ^ b, (EnumSet<TestEnum>{TestEnum::A, TestEnum::C}));
+        EXPECT_EQ(a - b, EnumSet<TestEnum>{TestEnum::A});
+
+        EXPECT_TRUE(a.intersects(b));
+        EXPECT_FALSE((a - b).intersects(b));
+        EXPECT_TRUE(EnumSet<TestEnum>{TestEnum::B}.is_subset_of(a));
+        EXPECT_TRUE(a.is_superset_of(a & b));
+        EXPECT_FALSE(a.is_subset_of(b));
+
+        a.flip(TestEnum::D).reset(TestEnum::A);
+
+        EXPECT_EQ(a, (EnumSet<TestEnum>{TestEnum::B, TestEnum::D}));
+        EXPECT_TRUE(a.reset().none());
+        EXPECT_TRUE(a.set().all());
+    }
+
+    /// @brief Test the API kept from `std::bitset`.
+    ///
+    /// @details
+    /// The test succeeds if shifts, conversions, stream operators and hashing behave as those of the equivalent
+    /// bitset.
+    TEST(UtilsTest, EnumSetBitsetCompatibility)
+    {
+        EnumSet<LargeEnum> set{};
+        EnumSet<LargeEnum>::BaseType bits{};
+
+        for (std::size_t pos : {0, 5, 63, 64, 130, 255})
+        {
+            set.set(pos);
+            bits.set(pos);
+        }
+
+        for (std::size_t count : {0, 1, 63, 64, 65, 200, 256})
+        {
+            EXPECT_EQ(static_cast<EnumSet<LargeEnum>::BaseType>(set << count), bits << count);
+            EXPECT_EQ(static_cast<EnumSet<LargeEnum>::BaseType>(set >> count), bits >> count);
+        }
+
+        // Explicit conversion to the bitset, and back
+        auto count_bits = [](const std::bitset<256>& value)
+        {
+            return value.count();
+        };
+
+        EXPECT_EQ(count_bits(static_cast<EnumSet<LargeEnum>::BaseType>(set)), 6);
+        EXPECT_EQ(EnumSet<LargeEnum>{bits}, set);
+
+        // No silent conversions from/to integers or between sets of different enumerations
+        static_assert(!std::is_convertible_v<EnumSet<TestEnum>, EnumSet<TestEnum>::BaseType>);
+        static_assert(!std::is_convertible_v<unsigned long long, EnumSet<TestEnum>>);
+        static_assert(!std::is_convertible_v<EnumSet<TestEnum>, EnumSet<LargeEnum>>);
+        static_assert(!std::equality_comparable_with<EnumSet<TestEnum>, int>);
+        static_assert(EnumSet<TestEnum>{0b0101ULL} == EnumSet<TestEnum>{TestEnum::A, TestEnum::C});
+
+        EnumSet<TestEnum> small{TestEnum::A, TestEnum::C};
+
+        EXPECT_EQ(small.to_ulong(), 0b0101);
+        EXPECT_THROW(set.to_ulong(), std::overflow_error);
+
+        std::ostringstream output{};
+        output << small;
+
+        EXPECT_EQ(output.str(), "0101");
+
+        EnumSet<TestEnum> parsed{};
+        std::istringstream input{"1010"};
+        input >> parsed;
+
+        EXPECT_EQ(parsed, (EnumSet<TestEnum>{TestEnum::B, TestEnum::D}));
+
+        std::unordered_set<EnumSet<TestEnum>> hashed{small, parsed, small};
+
+        EXPECT_EQ(hashed.size(), 2);
+    }
+
+    /// @brief Test iterating over the values that are set.
+    TEST(UtilsTest, EnumSetIteration)
+    {
+        EnumSet<LargeEnum> set{};
+        std::vector<std::size_t> expected{0, 5, 63, 64, 130, 255};
+
+        for (auto i : expected)
+        {
+            set.set(i);
+        }
+
+        EXPECT_EQ(set.size(), 256);
+        EXPECT_EQ(set.count(), expected.size());
+        EXPECT_THROW(set.to_ullong(), std::overflow_error);
+
+        std::vector<std::size_t> values{};
+
+        for (auto value : set)
+        {
+            values.push_back(static_cast<std::size_t>(value));
+        }
+
+        EXPECT_EQ(values, expected);
+
+        // Flipping does not set bits beyond the size of the set
+        set.flip();
+
+        EXPECT_EQ(set.count(), 256 - expected.size());
+        EXPECT_EQ(EnumSet<LargeEnum>{}.begin(), EnumSet<LargeEnum>{}.end());
+    }
+
+    /// @brief Test modifying an AtomicEnumSet from several threads.
+    ///
+    /// @details
+    /// The test succeeds if each bit is claimed by a single thread.
+    TEST(UtilsTest, AtomicEnumSetThreads)
+    {
+        AtomicEnumSet<LargeEnum> set{};
+        std::vector<std::size_t> claimed(4, 0);
+        std::vector<std::thread> threads{};
+
+        EXPECT_TRUE(AtomicEnumSet<LargeEnum>::is_always_lock_free);
+
+        for (std::size_t t = 0; t < claimed.size(); t++)
+        {
+            threads.emplace_back(
+                [&set, &claimed, t]()
+                {
+                    for (std::size_t i = 0; i < 256; i++)
+                    {
+                        if (!set.test_and_set(static_cast<LargeEnum>(i)))
+                        {
+                            claimed[t]++;
+                        }
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(claimed[0] + claimed[1] + claimed[2] + claimed[3], 256);
+        EXPECT_TRUE(set.load().all());
+
+        set.reset(LargeEnum::First);
+
+        EXPECT_FALSE(set.test(LargeEnum::First));
+        EXPECT_FALSE(set.test_and_reset(LargeEnum::First));
+
+        auto previous{set.fetch_and(EnumSet<LargeEnum>{0b110})};
+
+        EXPECT_EQ(previous.count(), 255);
+        EXPECT_EQ(set.load(), EnumSet<LargeEnum>{0b110});
+
+        previous = set.fetch_or(EnumSet<LargeEnum>{0b1});
+
+        EXPECT_EQ(previous, EnumSet<LargeEnum>{0b110});
+        EXPECT_EQ(set.load().to_ullong(), 0b111);
+
+        EXPECT_THROW(set.set(static_cast<LargeEnum>(256)), std::out_of_range);
+    }
 }  // namespace kouta::tests::utils